@@ -0,0 +1,35 @@
+; Job-shop scheduling, 3 jobs x 3 machines, makespan <= 35 (unsat)
+; Each job visits the machines in the listed order; tasks on a machine do not overlap.
+(set-logic QF_IDL)
+(declare-const t_0_0 Int)
+(declare-const t_0_1 Int)
+(declare-const t_0_2 Int)
+(declare-const t_1_0 Int)
+(declare-const t_1_1 Int)
+(declare-const t_1_2 Int)
+(declare-const t_2_0 Int)
+(declare-const t_2_1 Int)
+(declare-const t_2_2 Int)
+(assert (>= t_0_0 0))
+(assert (>= (- t_0_1 t_0_0) 6))
+(assert (>= (- t_0_2 t_0_1) 8))
+(assert (<= t_0_2 33))
+(assert (>= t_1_0 0))
+(assert (>= (- t_1_1 t_1_0) 8))
+(assert (>= (- t_1_2 t_1_1) 5))
+(assert (<= t_1_2 26))
+(assert (>= t_2_0 0))
+(assert (>= (- t_2_1 t_2_0) 8))
+(assert (>= (- t_2_2 t_2_1) 9))
+(assert (<= t_2_2 26))
+(assert (or (>= (- t_1_1 t_0_2) 2) (>= (- t_0_2 t_1_1) 5)))
+(assert (or (>= (- t_2_2 t_0_2) 2) (>= (- t_0_2 t_2_2) 9)))
+(assert (or (>= (- t_2_2 t_1_1) 5) (>= (- t_1_1 t_2_2) 9)))
+(assert (or (>= (- t_1_0 t_0_0) 6) (>= (- t_0_0 t_1_0) 8)))
+(assert (or (>= (- t_2_0 t_0_0) 6) (>= (- t_0_0 t_2_0) 8)))
+(assert (or (>= (- t_2_0 t_1_0) 8) (>= (- t_1_0 t_2_0) 8)))
+(assert (or (>= (- t_1_2 t_0_1) 8) (>= (- t_0_1 t_1_2) 9)))
+(assert (or (>= (- t_2_1 t_0_1) 8) (>= (- t_0_1 t_2_1) 9)))
+(assert (or (>= (- t_2_1 t_1_2) 9) (>= (- t_1_2 t_2_1) 9)))
+(check-sat)
+; expected: unsat
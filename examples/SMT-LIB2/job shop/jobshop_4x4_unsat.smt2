@@ -0,0 +1,65 @@
+; Job-shop scheduling, 4 jobs x 4 machines, makespan <= 30 (unsat)
+; Each job visits the machines in the listed order; tasks on a machine do not overlap.
+(set-logic QF_IDL)
+(declare-const t_0_0 Int)
+(declare-const t_0_1 Int)
+(declare-const t_0_2 Int)
+(declare-const t_0_3 Int)
+(declare-const t_1_0 Int)
+(declare-const t_1_1 Int)
+(declare-const t_1_2 Int)
+(declare-const t_1_3 Int)
+(declare-const t_2_0 Int)
+(declare-const t_2_1 Int)
+(declare-const t_2_2 Int)
+(declare-const t_2_3 Int)
+(declare-const t_3_0 Int)
+(declare-const t_3_1 Int)
+(declare-const t_3_2 Int)
+(declare-const t_3_3 Int)
+(assert (>= t_0_0 0))
+(assert (>= (- t_0_1 t_0_0) 9))
+(assert (>= (- t_0_2 t_0_1) 1))
+(assert (>= (- t_0_3 t_0_2) 8))
+(assert (<= t_0_3 26))
+(assert (>= t_1_0 0))
+(assert (>= (- t_1_1 t_1_0) 6))
+(assert (>= (- t_1_2 t_1_1) 8))
+(assert (>= (- t_1_3 t_1_2) 4))
+(assert (<= t_1_3 23))
+(assert (>= t_2_0 0))
+(assert (>= (- t_2_1 t_2_0) 1))
+(assert (>= (- t_2_2 t_2_1) 4))
+(assert (>= (- t_2_3 t_2_2) 7))
+(assert (<= t_2_3 25))
+(assert (>= t_3_0 0))
+(assert (>= (- t_3_1 t_3_0) 2))
+(assert (>= (- t_3_2 t_3_1) 3))
+(assert (>= (- t_3_3 t_3_2) 8))
+(assert (<= t_3_3 27))
+(assert (or (>= (- t_1_3 t_0_0) 9) (>= (- t_0_0 t_1_3) 7)))
+(assert (or (>= (- t_2_3 t_0_0) 9) (>= (- t_0_0 t_2_3) 5)))
+(assert (or (>= (- t_3_1 t_0_0) 9) (>= (- t_0_0 t_3_1) 3)))
+(assert (or (>= (- t_2_3 t_1_3) 7) (>= (- t_1_3 t_2_3) 5)))
+(assert (or (>= (- t_3_1 t_1_3) 7) (>= (- t_1_3 t_3_1) 3)))
+(assert (or (>= (- t_3_1 t_2_3) 5) (>= (- t_2_3 t_3_1) 3)))
+(assert (or (>= (- t_1_0 t_0_1) 1) (>= (- t_0_1 t_1_0) 6)))
+(assert (or (>= (- t_2_0 t_0_1) 1) (>= (- t_0_1 t_2_0) 1)))
+(assert (or (>= (- t_3_3 t_0_1) 1) (>= (- t_0_1 t_3_3) 3)))
+(assert (or (>= (- t_2_0 t_1_0) 6) (>= (- t_1_0 t_2_0) 1)))
+(assert (or (>= (- t_3_3 t_1_0) 6) (>= (- t_1_0 t_3_3) 3)))
+(assert (or (>= (- t_3_3 t_2_0) 1) (>= (- t_2_0 t_3_3) 3)))
+(assert (or (>= (- t_1_1 t_0_3) 4) (>= (- t_0_3 t_1_1) 8)))
+(assert (or (>= (- t_2_2 t_0_3) 4) (>= (- t_0_3 t_2_2) 7)))
+(assert (or (>= (- t_3_0 t_0_3) 4) (>= (- t_0_3 t_3_0) 2)))
+(assert (or (>= (- t_2_2 t_1_1) 8) (>= (- t_1_1 t_2_2) 7)))
+(assert (or (>= (- t_3_0 t_1_1) 8) (>= (- t_1_1 t_3_0) 2)))
+(assert (or (>= (- t_3_0 t_2_2) 7) (>= (- t_2_2 t_3_0) 2)))
+(assert (or (>= (- t_1_2 t_0_2) 8) (>= (- t_0_2 t_1_2) 4)))
+(assert (or (>= (- t_2_1 t_0_2) 8) (>= (- t_0_2 t_2_1) 4)))
+(assert (or (>= (- t_3_2 t_0_2) 8) (>= (- t_0_2 t_3_2) 8)))
+(assert (or (>= (- t_2_1 t_1_2) 4) (>= (- t_1_2 t_2_1) 4)))
+(assert (or (>= (- t_3_2 t_1_2) 4) (>= (- t_1_2 t_3_2) 8)))
+(assert (or (>= (- t_3_2 t_2_1) 4) (>= (- t_2_1 t_3_2) 8)))
+(check-sat)
+; expected: unsat
@@ -401,6 +401,7 @@ eautomaton* re2automaton::seq2aut(expr* e) {
 void seq_rewriter::updt_params(params_ref const & p) {
     seq_rewriter_params sp(p);
     m_coalesce_chars = sp.coalesce_chars();
+    m_op_cache.set_max_size(sp.op_cache_size());
 }
 
 void seq_rewriter::get_param_descrs(param_descrs & r) {
@@ -5997,14 +5998,26 @@ bool seq_rewriter::reduce_subsequence(expr_ref_vector& ls, expr_ref_vector& rs,
 } 
 
 seq_rewriter::op_cache::op_cache(ast_manager& m):
-    m_trail(m)
+    m_trail(m),
+    m_old_trail(m)
 {}
 
 expr* seq_rewriter::op_cache::find(decl_kind op, expr* a, expr* b, expr* c) {
     op_entry e(op, a, b, c, nullptr);
-    m_table.find(e, e);
-
-    return e.r;
+    if (m_table.find(e, e)) {
+        m_hits++;
+        return e.r;
+    }
+    if (m_old_table.find(e, e)) {
+        m_hits++;
+        // insert may drop the previous generation, so hold on to the result
+        expr_ref r(e.r, m_trail.get_manager());
+        m_promoted++;
+        insert(op, a, b, c, r);
+        return r;
+    }
+    m_misses++;
+    return nullptr;
 }
 
 void seq_rewriter::op_cache::insert(decl_kind op, expr* a, expr* b, expr* c, expr* r) {
@@ -6016,8 +6029,18 @@ void seq_rewriter::op_cache::insert(decl_kind op, expr* a, expr* b, expr* c, exp
     m_table.insert(op_entry(op, a, b, c, r));
 }
 
+void seq_rewriter::op_cache::collect_statistics(statistics& st) const {
+    st.update("seq op cache hits", m_hits);
+    st.update("seq op cache misses", m_misses);
+    st.update("seq op cache evictions", m_evictions);
+}
+
 void seq_rewriter::op_cache::cleanup() {
     if (m_table.size() >= m_max_cache_size) {
+        m_evictions += m_old_table.size() - m_promoted;
+        m_promoted = 0;
+        m_old_trail.swap(m_trail);
+        m_old_table.swap(m_table);
         m_trail.reset();
         m_table.reset();
         STRACE("seq_regex", tout << "Op cache reset!" << std::endl;);
@@ -24,6 +24,7 @@ Notes:
 #include "ast/rewriter/rewriter_types.h"
 #include "ast/rewriter/bool_rewriter.h"
 #include "util/params.h"
+#include "util/statistics.h"
 #include "util/lbool.h"
 #include "util/sign.h"
 #include "math/automata/automaton.h"
@@ -136,15 +137,28 @@ class seq_rewriter {
 
         typedef hashtable<op_entry, hash_entry, eq_entry> op_table;
 
+        /**
+           The cache keeps two generations. When the current generation is full
+           it replaces the previous one, and entries found in the previous 
+           generation are moved back to the current one. Frequently used
+           entries, such as derivatives of regexes that are checked repeatedly,
+           therefore survive the size limit.
+        */
         unsigned        m_max_cache_size { 10000 };
-        expr_ref_vector m_trail;
-        op_table        m_table;
+        expr_ref_vector m_trail, m_old_trail;
+        op_table        m_table, m_old_table;
+        unsigned        m_hits { 0 };
+        unsigned        m_misses { 0 };
+        unsigned        m_evictions { 0 };
+        unsigned        m_promoted { 0 };  // entries of the previous generation moved to the current one
         void cleanup();
 
     public:
         op_cache(ast_manager& m);
         expr* find(decl_kind op, expr* a, expr* b, expr* c);
         void insert(decl_kind op, expr* a, expr* b, expr* c, expr* r);
+        void set_max_size(unsigned sz) { m_max_cache_size = std::max(sz, 1u); }
+        void collect_statistics(statistics& st) const;
     };
 
     seq_util       m_util;
@@ -364,6 +378,7 @@ public:
 
     void updt_params(params_ref const & p);
     static void get_param_descrs(param_descrs & r);
+    void collect_statistics(statistics& st) const { m_op_cache.collect_statistics(st); }
 
     void set_solver(expr_solver* solver) { m_re2aut.set_solver(solver); }
     bool has_solver() { return m_re2aut.has_solver(); }
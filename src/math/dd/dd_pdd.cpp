@@ -23,7 +23,8 @@ Revision History:
 
 namespace dd {
 
-    pdd_manager::pdd_manager(unsigned num_vars, semantics s, unsigned power_of_2) {
+    pdd_manager::pdd_manager(unsigned num_vars, semantics s, unsigned power_of_2):
+        m_node_table(DEFAULT_HASHTABLE_INITIAL_CAPACITY, hash_node(this), eq_node(this)) {
         m_spare_entry = nullptr;
         m_max_num_nodes = 1 << 24; // up to 16M nodes
         m_mark_level = 0;
@@ -50,7 +51,10 @@ namespace dd {
     }
 
     void pdd_manager::reset(unsigned_vector const& level2var) {
-        reset_op_cache();
+        // op cache entries are released in bulk together with the allocator.
+        m_op_cache.reset();
+        m_spare_entry = nullptr;
+        m_alloc.reset();
         m_factor_cache.reset();
         m_node_table.reset();
         m_nodes.reset();
@@ -59,6 +63,7 @@ namespace dd {
         m_values.reset();
         m_free_values.reset();
         m_mpq_table.reset();  
+        m_small_values.reset();
         init_nodes(level2var);
     }
 
@@ -71,6 +76,7 @@ namespace dd {
         }
         init_value(rational::zero(), 0);
         init_value(rational::one(), 1);
+        m_small_values.resize(2 * small_value_bound, null_pdd);
         SASSERT(is_val(0));
         SASSERT(is_val(1));
         alloc_free_nodes(1024 + l2v.size());   
@@ -1234,12 +1240,30 @@ namespace dd {
             return imk_val(mod(r, rational(2)));
         if (m_semantics == mod2N_e && (r < 0 || r >= m_mod2N)) 
             return imk_val(mod(r, m_mod2N));
+        PDD* s = small_value(r);
+        if (s && *s != null_pdd)
+            return *s;
         const_info info;
         if (!m_mpq_table.find(r, info)) 
             init_value(info, r);
+        if (s)
+            *s = info.m_node_index;
         return info.m_node_index;
     }
 
+    /**
+       \brief slot caching the node of a small integer value.
+       It lets imk_val bypass hashing into m_mpq_table for the common coefficients.
+    */
+    pdd_manager::PDD* pdd_manager::small_value(rational const& r) {
+        if (!r.is_small() || !r.is_int())
+            return nullptr;
+        int64_t v = r.get_int64();
+        if (v < -small_value_bound || v >= small_value_bound)
+            return nullptr;
+        return &m_small_values[static_cast<unsigned>(v + small_value_bound)];
+    }
+
     void pdd_manager::init_value(const_info& info, rational const& r) {
         unsigned vi = 0;
         if (m_free_values.empty()) {
@@ -1279,33 +1303,28 @@ namespace dd {
     }
 
     pdd_manager::PDD pdd_manager::insert_node(node const& n) {
-        node_table::entry* e = m_node_table.insert_if_not_there2(n);
-        if (e->get_data().m_index != 0) {
-            unsigned result = e->get_data().m_index;
-            SASSERT(well_formed(e->get_data()));
+        m_probe = n;
+        PDD result;
+        if (m_node_table.find(null_pdd, result)) {
+            SASSERT(well_formed(m_nodes[result]));
             return result;
         }
-        e->get_data().m_refcount = 0;
         bool do_gc = m_free_nodes.empty();
-        if (do_gc && !m_disable_gc) {
+        if (do_gc && !m_disable_gc) 
             gc();
-            e = m_node_table.insert_if_not_there2(n);
-            e->get_data().m_refcount = 0;      
-        }
         if (do_gc) {
             if (m_nodes.size() > m_max_num_nodes) {
                 throw mem_out();
             }
             alloc_free_nodes(m_nodes.size()/2);
         }
-        SASSERT(e->get_data().m_lo == n.m_lo);
-        SASSERT(e->get_data().m_hi == n.m_hi);
-        SASSERT(e->get_data().m_level == n.m_level);
         SASSERT(!m_free_nodes.empty());
-        unsigned result = m_free_nodes.back();
+        result = m_free_nodes.back();
         m_free_nodes.pop_back();
-        e->get_data().m_index = result;
-        m_nodes[result] = e->get_data();
+        m_nodes[result] = n;
+        m_nodes[result].m_refcount = 0;
+        m_nodes[result].m_index = result;
+        m_node_table.insert(result);
         SASSERT(well_formed(m_nodes[result]));
         m_is_new_node = true;        
         SASSERT(!m_free_nodes.contains(result));
@@ -1539,21 +1558,27 @@ namespace dd {
         IF_VERBOSE(13, verbose_stream() << "(pdd :gc " << m_nodes.size() << ")\n";);
         bool_vector reachable(m_nodes.size(), false);
         compute_reachable(reachable);
+        // unreachable nodes are removed from the node table one by one,
+        // the reachable nodes stay where they are.
         for (unsigned i = m_nodes.size(); i-- > pdd_no_op; ) {
             if (!reachable[i]) {
-                if (is_val(i)) {
-                    if (m_freeze_value == val(i)) continue;
-                    m_free_values.push_back(m_mpq_table.find(val(i)).m_value_index);
-                    m_mpq_table.remove(val(i));  
+                if (!is_internal(i)) {
+                    if (is_val(i)) {
+                        if (m_freeze_value == val(i)) continue;
+                        PDD* s = small_value(val(i));
+                        if (s)
+                            *s = null_pdd;
+                        m_free_values.push_back(m_mpq_table.find(val(i)).m_value_index);
+                        m_mpq_table.remove(val(i));  
+                    }
+                    m_node_table.remove(i);
                 }
                 m_nodes[i].set_internal();
                 SASSERT(m_nodes[i].m_refcount == 0);
                 m_free_nodes.push_back(i);       
             }
         }
-        // sort free nodes so that adjacent nodes are picked in order of use
-        std::sort(m_free_nodes.begin(), m_free_nodes.end());
-        m_free_nodes.reverse();
+        // free nodes are collected in decreasing order, so adjacent nodes are picked in order of use
 
         ptr_vector<op_entry> to_delete, to_keep;
         for (auto* e : m_op_cache) {            
@@ -1573,15 +1598,6 @@ namespace dd {
         }
 
         m_factor_cache.reset();
-
-        m_node_table.reset();
-        // re-populate node cache
-        for (unsigned i = m_nodes.size(); i-- > 2; ) {
-            if (reachable[i]) {
-                SASSERT(m_nodes[i].m_index == i);
-                m_node_table.insert(m_nodes[i]);
-            }
-        }
         SASSERT(well_formed());
     }
 
@@ -101,17 +101,28 @@ namespace dd {
             void set_internal() { m_lo = 0; m_hi = 0; }
         };
 
+        /**
+           The node table stores indices into m_nodes instead of copies of the nodes.
+           Lookups of nodes that are not yet allocated go through the probe node
+           m_probe, which is addressed by null_pdd.
+        */
         struct hash_node {
-            unsigned operator()(node const& n) const { return n.hash(); }
+            pdd_manager const* m;
+            hash_node(pdd_manager const* m): m(m) {}
+            unsigned operator()(PDD p) const { return m->table_node(p).hash(); }
         };
 
         struct eq_node {
-            bool operator()(node const& a, node const& b) const {
+            pdd_manager const* m;
+            eq_node(pdd_manager const* m): m(m) {}
+            bool operator()(PDD p, PDD q) const {
+                node const& a = m->table_node(p);
+                node const& b = m->table_node(q);
                 return a.m_lo == b.m_lo && a.m_hi == b.m_hi && a.m_level == b.m_level;
             }
         };
         
-        typedef hashtable<node, hash_node, eq_node> node_table;
+        typedef hashtable<PDD, hash_node, eq_node> node_table;
 
         struct const_info {
             unsigned m_value_index;
@@ -182,7 +193,9 @@ namespace dd {
         typedef hashtable<factor_entry, hash_factor_entry, eq_factor_entry> factor_table;
 
         svector<node>              m_nodes;
+        node                       m_probe;
         vector<rational>           m_values;
+        svector<PDD>               m_small_values;  // small integer value + small_value_bound -> node, or null_pdd
         op_table                   m_op_cache;
         factor_table               m_factor_cache;
         node_table                 m_node_table;
@@ -214,6 +227,7 @@ namespace dd {
         void init_nodes(unsigned_vector const& l2v);
         void init_vars(unsigned_vector const& l2v);
 
+        node const& table_node(PDD p) const { return p == null_pdd ? m_probe : m_nodes[p]; }
         PDD make_node(unsigned level, PDD l, PDD r);
         PDD insert_node(node const& n);
         bool is_new_node() const { return m_is_new_node; }
@@ -230,6 +244,8 @@ namespace dd {
         PDD lt_quotient(PDD p, PDD q);
         PDD lt_quotient_hi(PDD p, PDD q);
 
+        static const int small_value_bound = 1024;
+        PDD* small_value(rational const& r);
         PDD imk_val(rational const& r);       
         void init_value(const_info& info, rational const& r);
         void init_value(rational const& v, unsigned r);
@@ -319,6 +335,7 @@ namespace dd {
 
         void reset(unsigned_vector const& level2var);
         void set_max_num_nodes(unsigned n) { m_max_num_nodes = n; }
+        unsigned max_num_nodes() const { return m_max_num_nodes; }
         unsigned_vector const& get_level2var() const { return m_level2var; }
 
         pdd mk_var(unsigned i);
@@ -12,9 +12,14 @@
   --*/
 
 #include "util/uint_set.h"
+#include "util/map.h"
+#include "util/scoped_ptr_vector.h"
 #include "math/grobner/pdd_solver.h"
 #include "math/grobner/pdd_simplifier.h"
 #include <math.h>
+#ifndef SINGLE_THREAD
+#include <thread>
+#endif
 
 
 namespace dd {
@@ -95,6 +100,13 @@ namespace dd {
         }
         init_saturate();
         TRACE("dd.solver", display(tout););
+        if (m_config.m_num_threads > 1) 
+            saturate_parallel();
+        else
+            saturate_steps();
+    }
+
+    void solver::saturate_steps() {
         try {
             while (!done() && step()) {
                 TRACE("dd.solver", display(tout););
@@ -109,6 +121,151 @@ namespace dd {
         }
     }
 
+    /**
+       \brief copy p into dst. The managers range over the same variables,
+       but may order them differently. Shared sub-terms are copied once.
+    */
+    static pdd copy_pdd(pdd_manager& dst, pdd const& p, u_map<unsigned>& cache, vector<pdd>& copies) {
+        unsigned idx;
+        if (cache.find(p.index(), idx))
+            return copies[idx];
+        pdd r = p.is_val() ? dst.mk_val(p.val()) :
+            dst.mk_var(p.var()) * copy_pdd(dst, p.hi(), cache, copies) + copy_pdd(dst, p.lo(), cache, copies);
+        cache.insert(p.index(), copies.size());
+        copies.push_back(r);
+        return r;
+    }
+
+    static u_dependency* copy_dep(u_dependency_manager& src, u_dependency_manager& dst, u_dependency* d) {
+        if (!d)
+            return nullptr;
+        vector<unsigned, false> leaves;
+        src.linearize(d, leaves);
+        u_dependency* r = nullptr;
+        for (unsigned l : leaves)
+            r = dst.mk_join(r, dst.mk_leaf(l));
+        return r;
+    }
+
+    /**
+       \brief saturate using m_num_threads - 1 additional shards.
+
+       pdd_manager is not thread-safe, so each shard owns a manager with the same
+       semantics, a dependency manager and a resource limit. A shard starts from a copy of the current
+       equations under a perturbed variable order and saturates in its own thread,
+       while this solver saturates in the calling thread.
+       Conflicts and linear equations derived by the shards are imported after
+       all threads are joined, in shard order, so the outcome does not depend on
+       how the threads were scheduled.
+    */
+    void solver::saturate_parallel() {
+#ifdef SINGLE_THREAD
+        saturate_steps();
+#else
+        unsigned num_shards = m_config.m_num_threads - 1;
+        unsigned_vector const& l2v = m.get_level2var();
+        random_gen rand(m_config.m_random_seed);
+        scoped_ptr_vector<reslimit> limits;
+        scoped_limits sl(m_limit);
+        scoped_ptr_vector<pdd_manager> managers;
+        scoped_ptr_vector<solver> shards;
+        for (unsigned i = 0; i < num_shards; ++i) {
+            unsigned_vector order(l2v);
+            for (unsigned j = 0; j + 1 < order.size(); ++j)
+                if (rand(4) == 0)
+                    std::swap(order[j], order[j + 1]);
+            limits.push_back(alloc(reslimit));
+            sl.push_child(limits.back());
+            managers.push_back(alloc(pdd_manager, order.size(), m.get_semantics(), m.power_of_2()));
+            pdd_manager& sm = *managers.back();
+            sm.reset(order);
+            shards.push_back(alloc(solver, *limits.back(), sm));
+            solver& s = *shards.back();
+            config cfg = m_config;
+            cfg.m_num_threads = 1;
+            cfg.m_random_seed += i + 1;
+            s.set(cfg);
+            u_map<unsigned> cache;
+            vector<pdd> copies;
+            for (auto const& [v, p, d] : m_subst)
+                s.add_subst(v, copy_pdd(sm, p, cache, copies), copy_dep(m_dep_manager, s.m_dep_manager, d));
+            for (equation* e : equations())
+                s.add(copy_pdd(sm, e->poly(), cache, copies), copy_dep(m_dep_manager, s.m_dep_manager, e->dep()));
+            sm.set_max_num_nodes(m.max_num_nodes());
+        }
+
+        // cancel and join the shards also when saturate_steps throws,
+        // a joinable std::thread must not be destroyed.
+        struct join_shards {
+            scoped_ptr_vector<reslimit>& m_limits;
+            vector<std::thread>          m_threads;
+            bool                         m_cancel = true;
+            join_shards(scoped_ptr_vector<reslimit>& limits): m_limits(limits) {}
+            ~join_shards() {
+                if (m_cancel)
+                    for (reslimit* l : m_limits)
+                        l->cancel();
+                for (auto& t : m_threads)
+                    if (t.joinable())
+                        t.join();
+            }
+        };
+
+        bool_vector failed(num_shards, false);
+        {
+            join_shards js(limits);
+            for (unsigned i = 0; i < num_shards; ++i) {
+                solver* s = shards[i];
+                bool* f = &failed[i];
+                js.m_threads.push_back(std::thread([s, f]() {
+                    try {
+                        s->saturate();
+                    }
+                    catch (...) {
+                        *f = true;
+                    }
+                }));
+                m_stats.m_shards++;
+            }
+            saturate_steps();
+            js.m_cancel = m_conflict != nullptr;
+        }
+
+        for (unsigned i = 0; i < num_shards && !m_conflict && !canceled(); ++i)
+            if (!failed[i])
+                import_from(*shards[i]);
+#endif
+    }
+
+    /**
+       \brief import conflicts and linear equations from a shard
+       that are not already among the equations of this solver.
+    */
+    void solver::import_from(solver& shard) {
+        uint_set seen;
+        for (equation* e : equations())
+            seen.insert(e->poly().index());
+        u_map<unsigned> cache;
+        vector<pdd> copies;
+        try {
+            for (equation* e : shard.equations()) {
+                if (m_conflict)
+                    return;
+                if (!shard.is_conflict(*e) && !e->poly().is_linear())
+                    continue;
+                pdd p = copy_pdd(m, e->poly(), cache, copies);
+                if (seen.contains(p.index()))
+                    continue;
+                seen.insert(p.index());
+                add(p, copy_dep(shard.m_dep_manager, m_dep_manager, e->dep()));
+                m_stats.m_imported++;
+            }
+        }
+        catch (pdd_manager::mem_out) {
+            IF_VERBOSE(2, verbose_stream() << "mem-out\n");
+        }
+    }
+
     void solver::scoped_process::done() {
         pdd p = e->poly();
         SASSERT(!p.is_val());
@@ -479,6 +636,8 @@ namespace dd {
         st.update("dd.solver.to_simplify", m_to_simplify.size());
         st.update("dd.solver.degree", m_stats.m_max_expr_degree);
         st.update("dd.solver.size", m_stats.m_max_expr_size);
+        st.update("dd.solver.shards", m_stats.m_shards);
+        st.update("dd.solver.imported", m_stats.m_imported);
     }
             
     std::ostream& solver::display(std::ostream & out, const equation & eq) const {
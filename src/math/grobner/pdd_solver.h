@@ -39,6 +39,8 @@ public:
         unsigned m_max_expr_degree;
         unsigned m_superposed;
         unsigned m_compute_steps;
+        unsigned m_shards;
+        unsigned m_imported;
         void reset() { memset(this, 0, sizeof(*this)); }
         stats() { reset(); }
         unsigned simplified() const { return m_simplified; }
@@ -60,6 +62,7 @@ public:
         unsigned m_expr_size_growth;
         unsigned m_expr_degree_growth;
         unsigned m_number_of_conflicts_to_report;
+        unsigned m_num_threads;
         config() :
             m_eqs_threshold(UINT_MAX),
             m_expr_size_limit(UINT_MAX),
@@ -71,7 +74,8 @@ public:
             m_eqs_growth(10),
             m_expr_size_growth(10),
             m_expr_degree_growth(5),
-            m_number_of_conflicts_to_report(1)
+            m_number_of_conflicts_to_report(1),
+            m_num_threads(1)
         {}
     };
 
@@ -155,6 +159,9 @@ public:
     unsigned number_of_conflicts_to_report() const { return m_config.m_number_of_conflicts_to_report; }
 
 private:
+    void saturate_steps();
+    void saturate_parallel();
+    void import_from(solver& shard);
     bool step();
     equation* pick_next();
     bool canceled();
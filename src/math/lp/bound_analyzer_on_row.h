@@ -28,13 +28,35 @@ Revision History:
 namespace lp {
 template <typename C, typename B> // C plays a role of a container, B - lp_bound_propagator
 class bound_analyzer_on_row {
+    // Summary of the activity of the row: the sum of the finite minimal (maximal)
+    // contributions of the monoids, the number of monoids whose contribution is
+    // unbounded, the last such monoid, and the number of strict contributions.
+    struct activity {
+        mpq      m_sum;
+        unsigned m_num_inf    { 0 };
+        int      m_inf_column { -1 };
+        unsigned m_num_strict { 0 };
+        void add_inf(unsigned j) {
+            m_num_inf++;
+            m_inf_column = j;
+        }
+        void add(mpq const& v, bool strict) {
+            m_sum += v;
+            if (strict)
+                m_num_strict++;
+        }
+        // the contributions of the monoids other than j are bounded
+        bool bounded_without(unsigned j) const {
+            return m_num_inf == 0 || (m_num_inf == 1 && m_inf_column == static_cast<int>(j));
+        }
+    };
+
     const C&                           m_row;
     B &                                m_bp;
     unsigned                           m_row_index;
-    int                                m_column_of_u; // index of an unlimited from above monoid
-    // -1 means that such a value is not found, -2 means that at least two of such monoids were found
-    int                                m_column_of_l; // index of an unlimited from below monoid
     impq                               m_rs;
+    activity                           m_min; // lower bound of the sum of the monoids
+    activity                           m_max; // upper bound of the sum of the monoids
 
 public :
     // constructor
@@ -48,8 +70,6 @@ public :
         m_row(it),
         m_bp(bp),
         m_row_index(row_or_term_index),
-        m_column_of_u(-1),
-        m_column_of_l(-1),
         m_rs(rs)
     {}
 
@@ -65,26 +85,21 @@ public :
 
 private:
 
+    /**
+       One pass over the row computes the activity summaries. Then the bound
+       implied for every monoid is obtained in constant time by removing the
+       monoid's own contribution from the summary.
+    */
     void analyze() {
         for (const auto & c : m_row) {
-            if ((m_column_of_l == -2) && (m_column_of_u == -2))
+            add_monoid(c.var(), c.coeff());
+            if (m_min.m_num_inf > 1 && m_max.m_num_inf > 1)
                 return;
-            analyze_bound_on_var_on_coeff(c.var(), c.coeff());
         }
-        if (m_column_of_u >= 0)
-            limit_monoid_u_from_below();
-        else if (m_column_of_u == -1)
-            limit_all_monoids_from_below();
-
-        if (m_column_of_l >= 0)
-            limit_monoid_l_from_above();
-        else if (m_column_of_l == -1)
-            limit_all_monoids_from_above();
-    }
-
-    bool bound_is_available(unsigned j, bool lower_bound) {
-        return (lower_bound && lower_bound_is_available(j)) ||
-            (!lower_bound && upper_bound_is_available(j));
+        if (m_max.m_num_inf <= 1)
+            limit_monoids_from_below();
+        if (m_min.m_num_inf <= 1)
+            limit_monoids_from_above();
     }
 
     bool upper_bound_is_available(unsigned j) const {
@@ -119,214 +134,82 @@ private:
         return m_bp.get_lower_bound(j);
     }
 
-    const mpq & monoid_max_no_mult(bool a_is_pos, unsigned j, bool & strict) const {
-        if (a_is_pos) {
-            strict = !is_zero(ub(j).y);
-            return ub(j).x;
-        }
-        strict = !is_zero(lb(j).y);
-        return lb(j).x;
-    }
-
-    mpq monoid_max(const mpq & a, unsigned j) const {
-        return a * (is_pos(a) ? ub(j).x : lb(j).x);
-    }
-
-    mpq monoid_max(const mpq & a, unsigned j, bool & strict) const {
-        if (is_pos(a)) {
-            strict = !is_zero(ub(j).y);
-            return a * ub(j).x;
-        }
-        strict = !is_zero(lb(j).y);
-        return a * lb(j).x;
-    }
-
-    const mpq & monoid_min_no_mult(bool a_is_pos, unsigned j, bool & strict) const {
-        if (!a_is_pos) {
-            strict = !is_zero(ub(j).y);
-            return ub(j).x;
-        }
-        strict = !is_zero(lb(j).y);
-        return lb(j).x;
+    // the bound of x_j giving the maximal (minimal) value of a*x_j, if available
+    const impq* max_bound(const mpq & a, unsigned j) const {
+        if (is_pos(a))
+            return upper_bound_is_available(j) ? &ub(j) : nullptr;
+        return lower_bound_is_available(j) ? &lb(j) : nullptr;
     }
 
-    mpq monoid_min(const mpq & a, unsigned j, bool& strict) const {
-        if (is_neg(a)) {
-            strict = !is_zero(ub(j).y);
-            return a * ub(j).x;
-        }        
-        strict = !is_zero(lb(j).y);
-        return a * lb(j).x;
+    const impq* min_bound(const mpq & a, unsigned j) const {
+        if (is_pos(a))
+            return lower_bound_is_available(j) ? &lb(j) : nullptr;
+        return upper_bound_is_available(j) ? &ub(j) : nullptr;
     }
 
-    mpq monoid_min(const mpq & a, unsigned j) const {
-        return a * (is_neg(a) ? ub(j).x : lb(j).x);
-    }
-    
-    mpq m_total, m_bound;
-    void limit_all_monoids_from_above() {
-        int strict = 0;
-        m_total.reset();
-        lp_assert(is_zero(m_total));
-        for (const auto& p : m_row) {
-            bool str;
-            m_total -= monoid_min(p.coeff(), p.var(), str);
-            if (str)
-                strict++;
-        }
-        
-        for (const auto &p : m_row) {
-            bool str;
-            bool a_is_pos = is_pos(p.coeff());
-            m_bound = m_total;
-            m_bound /= p.coeff();
-            m_bound += monoid_min_no_mult(a_is_pos, p.var(), str);
-            if (a_is_pos) {
-                limit_j(p.var(), m_bound, true, false, strict - static_cast<int>(str) > 0);
-            }
-            else {
-                limit_j(p.var(), m_bound, false, true, strict - static_cast<int>(str) > 0);
-            }
-        }
+    void add_monoid(unsigned j, const mpq & a) {
+        const impq* b = min_bound(a, j);
+        if (b)
+            m_min.add(a * b->x, !is_zero(b->y));
+        else
+            m_min.add_inf(j);
+        b = max_bound(a, j);
+        if (b)
+            m_max.add(a * b->x, !is_zero(b->y));
+        else
+            m_max.add_inf(j);
     }
 
-    void limit_all_monoids_from_below() {
-        int strict = 0;
-        m_total.reset();
-        lp_assert(is_zero(m_total));
-        for (const auto &p : m_row) {
-            bool str;
-            m_total -= monoid_max(p.coeff(), p.var(), str);
-            if (str)
-                strict++;
-        }
-
-        for (const auto& p : m_row) {
-            bool str;
-            bool a_is_pos = is_pos(p.coeff());
-            m_bound = m_total;
-            m_bound /= p.coeff();
-            m_bound += monoid_max_no_mult(a_is_pos, p.var(), str);
-            bool astrict = strict - static_cast<int>(str) > 0; 
-            if (a_is_pos) {
-                limit_j(p.var(), m_bound, true, true, astrict);
-            }
-            else {
-                limit_j(p.var(), m_bound, false, false, astrict);
-            }
-        }
-    }
+    mpq m_bound;
 
-    
-    void limit_monoid_u_from_below() {
-        // we are going to limit from below the monoid m_column_of_u,
-        // every other monoid is impossible to limit from below
-        mpq u_coeff;
-        unsigned j;
-        m_bound = -m_rs.x;
-        bool strict = false;
+    // a*x_j = -rs - sum of the other monoids >= -rs - (upper bound of the other monoids)
+    void limit_monoids_from_below() {
         for (const auto& p : m_row) {
-            j = p.var();
-            if (j == static_cast<unsigned>(m_column_of_u)) {
-                u_coeff = p.coeff();
+            unsigned j = p.var();
+            if (!m_max.bounded_without(j))
                 continue;
+            const mpq & a = p.coeff();
+            const impq* b = max_bound(a, j);
+            bool own_strict = false;
+            m_bound = -m_rs.x - m_max.m_sum;
+            if (b) {
+                m_bound += a * b->x;
+                own_strict = !is_zero(b->y);
             }
-            bool str;
-            m_bound -= monoid_max(p.coeff(), j, str);
-            if (str)
-                strict = true;
-        }
-
-        m_bound /= u_coeff;
-        
-        if (u_coeff.is_pos()) {
-            limit_j(m_column_of_u, m_bound, true, true, strict);
-        } else {
-            limit_j(m_column_of_u, m_bound, false, false, strict);
+            m_bound /= a;
+            bool strict = m_max.m_num_strict - static_cast<unsigned>(own_strict) > 0;
+            if (is_pos(a))
+                limit_j(j, m_bound, true, true, strict);
+            else
+                limit_j(j, m_bound, false, false, strict);
         }
     }
 
-
-    void limit_monoid_l_from_above() {
-        // we are going to limit from above the monoid m_column_of_l,
-        // every other monoid is impossible to limit from above
-        mpq l_coeff;
-        unsigned j;
-        m_bound = -m_rs.x;
-        bool strict = false;
-        for (const auto &p : m_row) {
-            j = p.var();
-            if (j == static_cast<unsigned>(m_column_of_l)) {
-                l_coeff = p.coeff();
+    // a*x_j = -rs - sum of the other monoids <= -rs - (lower bound of the other monoids)
+    void limit_monoids_from_above() {
+        for (const auto& p : m_row) {
+            unsigned j = p.var();
+            if (!m_min.bounded_without(j))
                 continue;
+            const mpq & a = p.coeff();
+            const impq* b = min_bound(a, j);
+            bool own_strict = false;
+            m_bound = -m_rs.x - m_min.m_sum;
+            if (b) {
+                m_bound += a * b->x;
+                own_strict = !is_zero(b->y);
             }
-
-            bool str;
-            m_bound -= monoid_min(p.coeff(), j, str);
-            if (str)
-                strict = true;
-        }
-        m_bound /= l_coeff;
-        if (is_pos(l_coeff)) {
-            limit_j(m_column_of_l, m_bound, true, false, strict);
-        } else {
-            limit_j(m_column_of_l, m_bound, false, true, strict);
+            m_bound /= a;
+            bool strict = m_min.m_num_strict - static_cast<unsigned>(own_strict) > 0;
+            if (is_pos(a))
+                limit_j(j, m_bound, true, false, strict);
+            else
+                limit_j(j, m_bound, false, true, strict);
         }
     }
-    
-    // // it is the coefficient before the bounded column
-    // void provide_evidence(bool coeff_is_pos) {
-    //     /*
-    //     auto & be = m_ibounds.back();
-    //     bool lower_bound = be.m_lower_bound;
-    //     if (!coeff_is_pos)
-    //         lower_bound = !lower_bound;
-    //     auto it = m_row.clone();
-    //     mpq a; unsigned j;
-    //     while (it->next(a, j)) {
-    //         if (be.m_j == j) continue;
-    //         lp_assert(bound_is_available(j, is_neg(a) ? lower_bound : !lower_bound));
-    //         be.m_vector_of_bound_signatures.emplace_back(a, j, numeric_traits<impq>::
-    //                                                      is_neg(a)? lower_bound: !lower_bound);
-    //     }
-    //     delete it;
-    //     */
-    // }
 
     void limit_j(unsigned j, const mpq& u, bool coeff_before_j_is_pos, bool is_lower_bound, bool strict){
         m_bp.try_add_bound(u, j, is_lower_bound, coeff_before_j_is_pos, m_row_index, strict);
     }
-    
-    void advance_u(unsigned j) {
-        m_column_of_u = (m_column_of_u == -1) ? j : -2;
-    }
-    
-    void advance_l(unsigned j) {
-        m_column_of_l = (m_column_of_l == -1) ? j : -2;
-    }
-    
-    void analyze_bound_on_var_on_coeff(int j, const mpq &a) {
-        switch (m_bp.get_column_type(j)) {
-        case column_type::lower_bound:
-            if (numeric_traits<mpq>::is_pos(a))
-                advance_u(j);
-            else 
-                advance_l(j);
-            break;
-        case column_type::upper_bound:
-            if (numeric_traits<mpq>::is_neg(a))
-                advance_u(j);
-            else
-                advance_l(j);
-            break;
-        case column_type::free_column:
-            advance_u(j);
-            advance_l(j);
-            break;
-        default:
-            break;
-        }
-    }   
 };
 }
-
@@ -829,7 +829,7 @@ namespace lp {
         auto& f = s.m_factorization;
         if (f != nullptr) {
             auto columns_to_replace = f->get_set_of_columns_to_replace_for_add_last_rows(s.m_basis_heading);
-            if (f->m_refactor_counter + columns_to_replace.size() >= 200 || f->has_dense_submatrix()) {
+            if (f->m_refactor_counter + columns_to_replace.size() >= m_settings.refactor_interval || f->has_dense_submatrix()) {
                 delete f;
                 f = nullptr;
             }
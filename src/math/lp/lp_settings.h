@@ -108,6 +108,7 @@ struct statistics {
     unsigned m_total_iterations;
     unsigned m_iters_with_no_cost_growing;
     unsigned m_num_factorizations;
+    unsigned m_num_lu_updates;
     unsigned m_num_of_implied_bounds;
     unsigned m_need_to_solve_inf;
     unsigned m_max_cols;
@@ -126,11 +127,13 @@ struct statistics {
     unsigned m_cross_nested_forms;
     unsigned m_grobner_calls;
     unsigned m_grobner_conflicts;
+    unsigned m_grobner_shards;
     unsigned m_offset_eqs;
     statistics() { reset(); }
     void reset() { memset(this, 0, sizeof(*this)); }
     void collect_statistics(::statistics& st) const {
         st.update("arith-factorizations", m_num_factorizations);
+        st.update("arith-lu-updates", m_num_lu_updates);
         st.update("arith-make-feasible", m_make_feasible);
         st.update("arith-max-columns", m_max_cols);
         st.update("arith-max-rows", m_max_rows);
@@ -147,6 +150,7 @@ struct statistics {
         st.update("arith-horner-cross-nested-forms", m_cross_nested_forms);
         st.update("arith-grobner-calls", m_grobner_calls);
         st.update("arith-grobner-conflicts", m_grobner_conflicts);
+        st.update("arith-grobner-shards", m_grobner_shards);
         st.update("arith-offset-eqs", m_offset_eqs);
 
     }
@@ -197,6 +201,9 @@ public:
     // dissertation of Achim Koberstein
     // if Bx - b is different at any component more that refactor_epsilon then we refactor
     double       refactor_tolerance { 1e-4 };
+    // the number of column replacements (Forrest-Tomlin updates) applied to an
+    // LU factorization before it is recomputed from scratch
+    unsigned     refactor_interval { 200 };
     double       pivot_tolerance { 1e-6 };
     double       zero_tolerance { 1e-12 };
     double       drop_tolerance { 1e-14 };
@@ -309,7 +309,7 @@ public:
     void prepare_entering(unsigned entering, indexed_vector<T> & w) {
         init_vector_w(entering, w);
     }
-    bool need_to_refactor() { return m_refactor_counter >= 200; }
+    bool need_to_refactor() { return m_refactor_counter >= m_settings.refactor_interval; }
     
     void adjust_dimension_with_matrix_A() {
         lp_assert(m_A.row_count() >= m_dim);
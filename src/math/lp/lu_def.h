@@ -908,6 +908,7 @@ row_eta_matrix<typename M::coefftype, typename M::argtype> *lu<M>::get_row_eta_m
 template <typename M>
 void lu<M>::replace_column(T pivot_elem_for_checking, indexed_vector<T> & w, unsigned leaving_column_of_U){
     m_refactor_counter++;
+    ++m_settings.stats().m_num_lu_updates;
     unsigned replaced_column =  transform_U_to_V_by_replacing_column( w, leaving_column_of_U);
     unsigned lowest_row_of_the_bump = m_U.lowest_row_in_column(replaced_column);
     m_r_wave.init(m_dim);
@@ -1727,6 +1727,7 @@ void core::collect_statistics(::statistics & st) {
     st.update("arith-nla-explanations", m_stats.m_nla_explanations);
     st.update("arith-nla-lemmas", m_stats.m_nla_lemmas);
     st.update("arith-nra-calls", m_stats.m_nra_calls);    
+    m_grobner.collect_statistics(st);
 }
 
 
@@ -41,6 +41,7 @@ namespace nla {
         find_nl_cluster();        
         configure();
         m_solver.saturate();
+        lp_settings().stats().m_grobner_shards += m_solver.get_stats().m_shards;
 
         if (is_conflicting())
             return;
@@ -239,6 +240,7 @@ namespace nla {
         cfg.m_expr_size_growth = c().m_nla_settings.grobner_expr_size_growth;
         cfg.m_expr_degree_growth = c().m_nla_settings.grobner_expr_degree_growth;
         cfg.m_number_of_conflicts_to_report = c().m_nla_settings.grobner_number_of_conflicts_to_report;
+        cfg.m_num_threads = c().m_nla_settings.grobner_threads;
         m_solver.set(cfg);
         m_solver.adjust_cfg();
         m_pdd_manager.set_max_num_nodes(10000); // or something proportional to the number of initial nodes.
@@ -60,5 +60,6 @@ namespace nla {
     public:
         grobner(core *core);        
         void operator()();
+        void collect_statistics(::statistics& st) const { m_solver.collect_statistics(st); }
     }; 
 }
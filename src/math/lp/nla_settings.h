@@ -32,6 +32,7 @@ namespace nla {
         unsigned grobner_number_of_conflicts_to_report = 1;
         unsigned grobner_quota      = 0;
         unsigned grobner_frequency  = 4;
+        unsigned grobner_threads    = 1;
 
 
         // nra fields
@@ -7060,6 +7060,10 @@ namespace polynomial {
             m_imp->dec_ref(p);
     }
 
+    unsigned manager::ref_count(polynomial const * p) const {
+        return p->ref_count();
+    }
+
     void manager::lex_sort(polynomial * p) {
         m_imp->lex_sort(p);
     }
@@ -269,6 +269,11 @@ namespace polynomial {
         void dec_ref(polynomial * p);
         void dec_ref(monomial * m);
 
+        /**
+           \brief Return the reference counter of p.
+        */
+        unsigned ref_count(polynomial const * p) const;
+
         /**
            \brief Return an unique id associated with \c m.
            This id can be used to implement efficient mappings from monomial to data.
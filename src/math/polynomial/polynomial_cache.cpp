@@ -38,6 +38,7 @@ namespace polynomial {
         polynomial const * m_q;
         var                m_x;
         unsigned           m_hash;
+        unsigned           m_last_used;
         unsigned           m_result_sz;
         polynomial **      m_result;
         
@@ -46,6 +47,7 @@ namespace polynomial {
             m_q(q),
             m_x(x),
             m_hash(h),
+            m_last_used(0),
             m_result_sz(0),
             m_result(nullptr) {
         }
@@ -93,8 +95,12 @@ namespace polynomial {
         polynomial_ref_vector    m_cached_polys;
         svector<char>            m_in_cache;
         small_object_allocator & m_allocator;
+        unsigned                 m_max_psc_entries;
+        unsigned                 m_psc_stamp;
+        cache::stats             m_stats;
 
-        imp(manager & _m):m(_m), m_poly_table(poly_hash_proc(m), poly_eq_proc(m)), m_cached_polys(m), m_allocator(m.allocator()) {
+        imp(manager & _m):m(_m), m_poly_table(poly_hash_proc(m), poly_eq_proc(m)), m_cached_polys(m), m_allocator(m.allocator()),
+            m_max_psc_entries(UINT_MAX), m_psc_stamp(0) {
         }
         
         ~imp() {
@@ -102,7 +108,23 @@ namespace polynomial {
             reset_factor_cache();
         }
 
+        // cache entries hold references to their polynomials, so that polynomials
+        // that are only referenced by the unique table can be released.
+        void inc_ref(polynomial const * p, unsigned sz, polynomial * const * ps) {
+            m.inc_ref(const_cast<polynomial*>(p));
+            for (unsigned i = 0; i < sz; i++)
+                m.inc_ref(ps[i]);
+        }
+
+        void dec_ref(polynomial const * p, unsigned sz, polynomial * const * ps) {
+            m.dec_ref(const_cast<polynomial*>(p));
+            for (unsigned i = 0; i < sz; i++)
+                m.dec_ref(ps[i]);
+        }
+
         void del_psc_chain_entry(psc_chain_entry * entry) {
+            m.dec_ref(const_cast<polynomial*>(entry->m_q));
+            dec_ref(entry->m_p, entry->m_result_sz, entry->m_result);
             if (entry->m_result_sz != 0)
                 m_allocator.deallocate(sizeof(polynomial*)*entry->m_result_sz, entry->m_result);
             entry->~psc_chain_entry();
@@ -110,6 +132,7 @@ namespace polynomial {
         }
 
         void del_factor_entry(factor_entry * entry) {
+            dec_ref(entry->m_p, entry->m_result_sz, entry->m_result);
             if (entry->m_result_sz != 0)
                 m_allocator.deallocate(sizeof(polynomial*)*entry->m_result_sz, entry->m_result);
             entry->~factor_entry();
@@ -148,31 +171,84 @@ namespace polynomial {
             return p_prime;
         }
 
+        /**
+           \brief Remove the unique polynomials that are only referenced by the cache.
+        */
+        void release_unused_polys() {
+            polynomial_ref_vector used(m);
+            for (polynomial * p : m_cached_polys) {
+                if (m.ref_count(p) > 1) {
+                    used.push_back(p);
+                    continue;
+                }
+                m_poly_table.erase(p);
+                m_in_cache[pid(p)] = false;
+                m_stats.m_psc_released++;
+            }
+            m_cached_polys.swap(used);
+        }
+
+        /**
+           \brief Evict the least recently used half of the psc chain cache
+           and release the polynomials that are no longer used.
+        */
+        void shrink_psc_chain_cache() {
+            ptr_vector<psc_chain_entry> entries;
+            for (psc_chain_entry * e : m_psc_chain_cache)
+                entries.push_back(e);
+            std::sort(entries.begin(), entries.end(), [](psc_chain_entry const * a, psc_chain_entry const * b) {
+                return a->m_last_used > b->m_last_used;
+            });
+            unsigned keep = m_max_psc_entries / 2;
+            m_psc_chain_cache.reset();
+            for (unsigned i = 0; i < entries.size(); i++) {
+                if (i < keep) {
+                    m_psc_chain_cache.insert(entries[i]);
+                }
+                else {
+                    del_psc_chain_entry(entries[i]);
+                    m_stats.m_psc_evictions++;
+                }
+            }
+            release_unused_polys();
+        }
+
         void psc_chain(polynomial * p, polynomial * q, var x, polynomial_ref_vector & S) {
             p = mk_unique(p);
             q = mk_unique(q);
-            unsigned h = hash_u_u(pid(p), pid(q));
-            psc_chain_entry * entry = new (m_allocator.allocate(sizeof(psc_chain_entry))) psc_chain_entry(p, q, x, h);
-            psc_chain_entry * old_entry = m_psc_chain_cache.insert_if_not_there(entry); 
-            if (entry != old_entry) {
-                entry->~psc_chain_entry();
-                m_allocator.deallocate(sizeof(psc_chain_entry), entry);
+            unsigned h = mk_mix(pid(p), pid(q), x);
+            psc_chain_entry key(p, q, x, h);
+            psc_chain_entry * old_entry = nullptr;
+            if (m_psc_chain_cache.find(&key, old_entry)) {
+                m_stats.m_psc_hits++;
+                old_entry->m_last_used = ++m_psc_stamp;
                 S.reset();
                 for (unsigned i = 0; i < old_entry->m_result_sz; i++) {
                     S.push_back(old_entry->m_result[i]);
                 }
+                return;
             }
-            else {
-                m.psc_chain(p, q, x, S);
-                unsigned sz = S.size();
-                entry->m_result_sz = sz;
-                entry->m_result    = static_cast<polynomial**>(m_allocator.allocate(sizeof(polynomial*)*sz));
-                for (unsigned i = 0; i < sz; i++) {
-                    polynomial * h = mk_unique(S.get(i));
-                    S.set(i, h);
-                    entry->m_result[i] = h;
-                }
+            m_stats.m_psc_misses++;
+            // the entry is only created once the chain is computed, so that
+            // an interrupted computation does not leave an empty result behind.
+            m.psc_chain(p, q, x, S);
+            if (m_psc_chain_cache.size() >= m_max_psc_entries) {
+                polynomial_ref _p(p, m), _q(q, m);
+                shrink_psc_chain_cache();
             }
+            psc_chain_entry * entry = new (m_allocator.allocate(sizeof(psc_chain_entry))) psc_chain_entry(p, q, x, h);
+            unsigned sz = S.size();
+            entry->m_last_used = ++m_psc_stamp;
+            entry->m_result_sz = sz;
+            entry->m_result    = static_cast<polynomial**>(m_allocator.allocate(sizeof(polynomial*)*sz));
+            for (unsigned i = 0; i < sz; i++) {
+                polynomial * h = mk_unique(S.get(i));
+                S.set(i, h);
+                entry->m_result[i] = h;
+            }
+            m.inc_ref(q);
+            inc_ref(p, sz, entry->m_result);
+            m_psc_chain_cache.insert(entry);
         }
 
         void factor(polynomial * p, polynomial_ref_vector & distinct_factors) {
@@ -200,6 +276,7 @@ namespace polynomial {
                     distinct_factors.push_back(h);
                     entry->m_result[i] = h;
                 }
+                inc_ref(p, sz, entry->m_result);
             }
         }
     };
@@ -230,7 +307,26 @@ namespace polynomial {
     
     void cache::reset() {
         manager & _m = m();
+        unsigned max_psc_entries = m_imp->m_max_psc_entries;
+        stats st = m_imp->m_stats;
         dealloc(m_imp);
         m_imp = alloc(imp, _m);
+        m_imp->m_max_psc_entries = max_psc_entries;
+        m_imp->m_stats = st;
+    }
+
+    void cache::set_max_psc_entries(unsigned n) {
+        m_imp->m_max_psc_entries = std::max(n, 2u);
+    }
+
+    void cache::collect_statistics(statistics & st) const {
+        st.update("polynomial psc cache hits", m_imp->m_stats.m_psc_hits);
+        st.update("polynomial psc cache misses", m_imp->m_stats.m_psc_misses);
+        st.update("polynomial psc cache evictions", m_imp->m_stats.m_psc_evictions);
+        st.update("polynomial psc cache released", m_imp->m_stats.m_psc_released);
+    }
+
+    void cache::reset_statistics() {
+        m_imp->m_stats.reset();
     }
 };
@@ -19,6 +19,7 @@ Notes:
 #pragma once
 
 #include "math/polynomial/polynomial.h"
+#include "util/statistics.h"
 
 namespace polynomial {
 
@@ -26,6 +27,16 @@ namespace polynomial {
        \brief Functor for creating unique polynomials and caching results of operations
     */
     class cache {
+    public:
+        struct stats {
+            unsigned m_psc_hits;
+            unsigned m_psc_misses;
+            unsigned m_psc_evictions;
+            unsigned m_psc_released;
+            stats() { reset(); }
+            void reset() { memset(this, 0, sizeof(*this)); }
+        };
+    private:
         struct imp;
         imp * m_imp;
     public:
@@ -37,6 +48,14 @@ namespace polynomial {
         void psc_chain(polynomial const * p, polynomial const * q, var x, polynomial_ref_vector & S);
         void factor(polynomial const * p, polynomial_ref_vector & distinct_factors);
         void reset();
+        /**
+           \brief Bound the number of cached psc chains. When the bound is reached,
+           the least recently used half of the entries is evicted, and unique
+           polynomials that are no longer referenced outside the cache are released.
+        */
+        void set_max_psc_entries(unsigned n);
+        void collect_statistics(statistics & st) const;
+        void reset_statistics();
     };
 };
 
@@ -320,26 +320,94 @@ namespace upolynomial {
             for (unsigned i = 0; i < new_sz; i++) {
                 m().reset(buffer[i]);
             }
-            if (sz1 < sz2) {
-                std::swap(sz1, sz2);
-                std::swap(p1, p2);
-            }
-            for (unsigned i = 0; i < sz1; i++) {
-                checkpoint();
-                numeral const & a_i = p1[i];
-                if (m().is_zero(a_i))
+            if (m_use_karatsuba)
+                addmul_karatsuba(sz1, p1, sz2, p2, buffer.data());
+            else 
+                addmul_schoolbook(sz1, p1, sz2, p2, buffer.data());
+            set_size(new_sz, buffer);
+        }
+    }
+
+    // r[0 .. sz1+sz2-2] += p1 * p2
+    void core_manager::addmul_schoolbook(unsigned sz1, numeral const * p1, unsigned sz2, numeral const * p2, numeral * r) {
+        if (sz1 < sz2) {
+            std::swap(sz1, sz2);
+            std::swap(p1, p2);
+        }
+        for (unsigned i = 0; i < sz1; i++) {
+            checkpoint();
+            numeral const & a_i = p1[i];
+            if (m().is_zero(a_i))
+                continue;
+            for (unsigned j = 0; j < sz2; j++) {
+                numeral const & b_j = p2[j];
+                if (m().is_zero(b_j))
                     continue;
-                for (unsigned j = 0; j < sz2; j++) {
-                    numeral const & b_j = p2[j];
-                    if (m().is_zero(b_j))
-                        continue;
-                    m().addmul(buffer[i+j], a_i, b_j, buffer[i+j]);
-                }
+                m().addmul(r[i+j], a_i, b_j, r[i+j]);
             }
-            set_size(new_sz, buffer);
         }
     }
 
+    /**
+       \brief r[0 .. sz1+sz2-2] += p1 * p2
+
+       Split p1 = a0 + x^k a1 and p2 = b0 + x^k b1 and use
+       
+          p1 * p2 = a0 b0 + x^k ((a0 + a1)(b0 + b1) - a0 b0 - a1 b1) + x^2k a1 b1
+
+       which takes three half-size products instead of four. Operands that are 
+       much longer than the other are processed in slices of the shorter length.
+       Small operands fall back to the schoolbook method.
+    */
+    void core_manager::addmul_karatsuba(unsigned sz1, numeral const * p1, unsigned sz2, numeral const * p2, numeral * r) {
+        if (sz1 < sz2) {
+            std::swap(sz1, sz2);
+            std::swap(p1, p2);
+        }
+        if (sz2 < karatsuba_threshold) {
+            addmul_schoolbook(sz1, p1, sz2, p2, r);
+            return;
+        }
+        unsigned k = (sz1 + 1) / 2;
+        if (sz2 <= k) {
+            for (unsigned i = 0; i < sz1; i += sz2) 
+                addmul_karatsuba(std::min(sz2, sz1 - i), p1 + i, sz2, p2, r + i);
+            return;
+        }
+        checkpoint();
+        unsigned n1 = sz1 - k;
+        unsigned n2 = sz2 - k;
+        scoped_numeral_vector sa(m()), sb(m()), z0(m()), z1(m()), z2(m());
+        sa.resize(k);
+        sb.resize(k);
+        for (unsigned i = 0; i < k; i++) {
+            if (i < n1) 
+                m().add(p1[i], p1[k + i], sa[i]);
+            else
+                m().set(sa[i], p1[i]);
+            if (i < n2) 
+                m().add(p2[i], p2[k + i], sb[i]);
+            else
+                m().set(sb[i], p2[i]);
+        }
+        z0.resize(2*k - 1);
+        z1.resize(2*k - 1);
+        z2.resize(n1 + n2 - 1);
+        addmul_karatsuba(k, p1, k, p2, z0.data());
+        addmul_karatsuba(n1, p1 + k, n2, p2 + k, z2.data());
+        addmul_karatsuba(k, sa.data(), k, sb.data(), z1.data());
+        for (unsigned i = 0; i < z0.size(); i++) {
+            m().sub(z1[i], z0[i], z1[i]);
+            m().add(r[i], z0[i], r[i]);
+        }
+        for (unsigned i = 0; i < z2.size(); i++) {
+            m().sub(z1[i], z2[i], z1[i]);
+            m().add(r[2*k + i], z2[i], r[2*k + i]);
+        }
+        for (unsigned i = 0; i < z1.size(); i++) 
+            m().add(r[k + i], z1[i], r[k + i]);
+    }
+
     void core_manager::mul(unsigned sz1, numeral const * p1, unsigned sz2, numeral const * p2, numeral_vector & buffer) {
         mul_core(sz1, p1, sz2, p2, m_basic_tmp);
         buffer.swap(m_basic_tmp);
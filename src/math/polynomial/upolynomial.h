@@ -115,12 +115,15 @@ namespace upolynomial {
         numeral_vector    m_sqf_tmp1;
         numeral_vector    m_sqf_tmp2;
         numeral_vector    m_pw_tmp;
+        bool              m_use_karatsuba = true;
 
         static bool is_alias(numeral const * p, numeral_vector & buffer) { return buffer.data() != nullptr && buffer.data() == p; }
         void neg_core(unsigned sz1, numeral const * p1, numeral_vector & buffer);
         void add_core(unsigned sz1, numeral const * p1, unsigned sz2, numeral const * p2, numeral_vector & buffer);
         void sub_core(unsigned sz1, numeral const * p1, unsigned sz2, numeral const * p2, numeral_vector & buffer);
         void mul_core(unsigned sz1, numeral const * p1, unsigned sz2, numeral const * p2, numeral_vector & buffer);
+        void addmul_schoolbook(unsigned sz1, numeral const * p1, unsigned sz2, numeral const * p2, numeral * r);
+        void addmul_karatsuba(unsigned sz1, numeral const * p1, unsigned sz2, numeral const * p2, numeral * r);
 
         void flip_sign_if_lm_neg(numeral_vector & buffer);
 
@@ -243,6 +246,12 @@ namespace upolynomial {
         void mul(unsigned sz1, numeral const * p1, unsigned sz2, numeral const * p2, numeral_vector & buffer);
         void mul(numeral_vector const & a, numeral_vector const & b, numeral_vector & c) { mul(a.size(), a.data(), b.size(), b.data(), c); }
 
+        /**
+           \brief Polynomials whose sizes are both at least this threshold are multiplied using Karatsuba.
+        */
+        static const unsigned karatsuba_threshold = 32;
+        void set_karatsuba(bool f) { m_use_karatsuba = f; }
+
         /**
            \brief r := p^k
         */
@@ -32,6 +32,7 @@ Revision History:
 #include "ast/rewriter/th_rewriter.h"
 #include "ast/rewriter/rewriter_def.h"
 #include "ast/rewriter/var_subst.h"
+#include "util/heap.h"
 #include "model/model_smt2_pp.h"
 #include "model/model.h"
 #include "model/model_evaluator_params.hpp"
@@ -676,6 +677,11 @@ struct model_evaluator::imp : public rewriter_tpl<mev::evaluator_cfg> {
         m_cfg(md.get_manager(), md, p) {
     }
     void expand_stores(expr_ref &val) {m_cfg.expand_stores(val);}
+    void flush_cache() {
+        rewriter_tpl<mev::evaluator_cfg>::reset();
+        m_cfg.m_def_cache.reset();
+        m_cfg.m_pinned.reset();
+    }
     void reset() {
         rewriter_tpl<mev::evaluator_cfg>::reset();
         m_cfg.reset();
@@ -683,6 +689,134 @@ struct model_evaluator::imp : public rewriter_tpl<mev::evaluator_cfg> {
     }
 };
 
+/**
+   \brief values of tracked subterms with reverse dependencies.
+   Subterms are numbered in post-order, so a term has a larger id than its
+   arguments and dirty terms can be re-evaluated in increasing id order.
+   Quantifiers are not traversed; they are re-evaluated as a whole.
+*/
+struct model_evaluator::inc {
+    struct lt {
+        bool operator()(int a, int b) const { return a < b; }
+    };
+    ast_manager&                        m;
+    array_util                          m_ar;
+    expr_ref_vector                     m_nodes;
+    expr_ref_vector                     m_values;
+    obj_map<expr, unsigned>             m_node2id;
+    vector<unsigned_vector>             m_parents;
+    obj_map<func_decl, unsigned_vector> m_occs;   // subterms that read the interpretation of a declaration
+    bool_vector                         m_is_root;
+    heap<lt>                            m_todo;
+
+    inc(ast_manager& m): m(m), m_ar(m), m_nodes(m), m_values(m), m_todo(1024) {}
+
+    void add_occ(func_decl* f, unsigned id) {
+        if (f->get_family_id() != null_family_id)
+            return;
+        auto& occs = m_occs.insert_if_not_there(f, unsigned_vector());
+        if (occs.empty() || occs.back() != id)
+            occs.push_back(id);
+    }
+
+    void add_occs(app* a, unsigned id) {
+        func_decl* f = nullptr;
+        add_occ(a->get_decl(), id);
+        if (m_ar.is_as_array(a, f))
+            add_occ(f, id);
+    }
+
+    bool is_leaf(expr* e) const {
+        return !is_app(e) || to_app(e)->get_num_args() == 0;
+    }
+
+    unsigned mk_node(expr* e) {
+        unsigned id = m_nodes.size();
+        m_nodes.push_back(e);
+        m_values.push_back(nullptr);
+        m_parents.push_back(unsigned_vector());
+        m_is_root.push_back(false);
+        m_node2id.insert(e, id);
+        if (is_app(e))
+            add_occs(to_app(e), id);
+        else if (is_quantifier(e))
+            for (expr* t : subterms::all(expr_ref(e, m)))
+                if (is_app(t))
+                    add_occs(to_app(t), id);
+        if (!is_leaf(e))
+            for (expr* arg : *to_app(e))
+                m_parents[m_node2id[arg]].push_back(id);
+        return id;
+    }
+
+    void eval(imp& ev, unsigned id, expr_ref& r) {
+        expr* e = m_nodes.get(id);
+        if (is_leaf(e))
+            ev(e, r);
+        else {
+            app* a = to_app(e);
+            expr_ref_vector args(m);
+            for (expr* arg : *a)
+                args.push_back(m_values.get(m_node2id[arg]));
+            ev(m.mk_app(a->get_decl(), args.size(), args.data()), r);
+        }
+        ev.expand_stores(r);
+    }
+
+    unsigned track(imp& ev, expr* t) {
+        ptr_vector<expr> todo;
+        todo.push_back(t);
+        expr_ref r(m);
+        while (!todo.empty()) {
+            expr* e = todo.back();
+            if (m_node2id.contains(e)) {
+                todo.pop_back();
+                continue;
+            }
+            bool visited = true;
+            if (!is_leaf(e))
+                for (expr* arg : *to_app(e))
+                    if (!m_node2id.contains(arg)) {
+                        todo.push_back(arg);
+                        visited = false;
+                    }
+            if (!visited)
+                continue;
+            todo.pop_back();
+            unsigned id = mk_node(e);
+            eval(ev, id, r);
+            m_values[id] = r;
+        }
+        m_todo.reserve(m_nodes.size());
+        unsigned id = m_node2id[t];
+        m_is_root[id] = true;
+        return id;
+    }
+
+    void update(imp& ev, unsigned n, func_decl* const* decls, ptr_vector<expr>& changed) {
+        for (unsigned i = 0; i < n; ++i)
+            if (auto* occs = m_occs.find_core(decls[i]))
+                for (unsigned id : occs->get_data().m_value)
+                    if (!m_todo.contains(id))
+                        m_todo.insert(id);
+        expr_ref r(m);
+        while (!m_todo.empty()) {
+            unsigned id = m_todo.erase_min();
+            eval(ev, id, r);
+            bool same = r == m_values.get(id);
+            // (as-array f) can evaluate to itself, but its readers depend on the interpretation of f
+            if (same && !m_ar.is_as_array(m_nodes.get(id)))
+                continue;
+            m_values[id] = r;
+            if (m_is_root[id] && !same)
+                changed.push_back(m_nodes.get(id));
+            for (unsigned p : m_parents[id])
+                if (!m_todo.contains(p))
+                    m_todo.insert(p);
+        }
+    }
+};
+
 model_evaluator::model_evaluator(model_core & md, params_ref const & p) {
     m_imp = alloc(imp, md, p);
 }
@@ -692,9 +826,36 @@ ast_manager & model_evaluator::m() const {
 }
 
 model_evaluator::~model_evaluator() {
+    dealloc(m_inc);
     dealloc(m_imp);
 }
 
+void model_evaluator::reset_tracked() {
+    dealloc(m_inc);
+    m_inc = nullptr;
+}
+
+void model_evaluator::track(expr* t) {
+    if (!m_inc)
+        m_inc = alloc(inc, m());
+    m_inc->track(*m_imp, t);
+}
+
+expr* model_evaluator::get_tracked_value(expr* t) const {
+    unsigned id;
+    if (m_inc && m_inc->m_node2id.find(t, id))
+        return m_inc->m_values.get(id);
+    return nullptr;
+}
+
+void model_evaluator::update(unsigned n, func_decl* const* decls, ptr_vector<expr>& changed) {
+    if (!m_inc)
+        return;
+    // cached results refer to the previous interpretations
+    m_imp->flush_cache();
+    m_inc->update(*m_imp, n, decls, changed);
+}
+
 void model_evaluator::updt_params(params_ref const & p) {
     m_imp->cfg().updt_params(p);
 }
@@ -723,17 +884,20 @@ unsigned model_evaluator::get_num_steps() const {
 }
 
 void model_evaluator::cleanup(params_ref const & p) {
+    reset_tracked();
     model_core & md = m_imp->cfg().m_model;
     m_imp->~imp();
     new (m_imp) imp(md, p);
 }
 
 void model_evaluator::reset(params_ref const & p) {
+    reset_tracked();
     m_imp->reset();
     updt_params(p);
 }
 
 void model_evaluator::reset(model_core &model, params_ref const& p) {
+    reset_tracked();
     m_imp->~imp();
     new (m_imp) imp(model, p);
 }
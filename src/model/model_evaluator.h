@@ -30,7 +30,11 @@ typedef rewriter_exception model_evaluator_exception;
 
 class model_evaluator {
     struct imp;
+    struct inc;
     imp *  m_imp;
+    inc *  m_inc = nullptr;
+
+    void reset_tracked();
 public:
     model_evaluator(model_core & m, params_ref const & p = params_ref());
     ~model_evaluator();
@@ -66,6 +70,18 @@ public:
      */
     expr_ref eval_array_eq(app* e, expr* arg1, expr* arg2);
 
+    /**
+     * incremental evaluation.
+     * track(t) evaluates t and keeps the values of its subterms.
+     * After the interpretations of decls change in the model, update
+     * re-evaluates only the tracked subterms that depend on them and
+     * collects the tracked terms whose value changed.
+     * Resetting the evaluator discards the tracked terms.
+     */
+    void track(expr* t);
+    expr* get_tracked_value(expr* t) const;
+    void update(unsigned n, func_decl* const* decls, ptr_vector<expr>& changed);
+
     void cleanup(params_ref const & p = params_ref());
     void reset(params_ref const & p = params_ref());
     void reset(model_core& model, params_ref const & p = params_ref());
@@ -341,6 +341,7 @@ namespace nlsat {
             m_explain.set_simplify_cores(m_simplify_cores);
             m_explain.set_minimize_cores(min_cores);
             m_explain.set_factor(p.factor());
+            m_cache.set_max_psc_entries(p.psc_cache_size());
             m_am.updt_params(p.p);
         }
 
@@ -2312,6 +2313,7 @@ namespace nlsat {
             st.update("nlsat decisions", m_decisions);
             st.update("nlsat stages", m_stages);
             st.update("nlsat irrational assignments", m_irrational_assignments);
+            m_cache.collect_statistics(st);
         }
 
         void reset_statistics() {
@@ -2320,6 +2322,7 @@ namespace nlsat {
             m_decisions              = 0;
             m_stages                 = 0;
             m_irrational_assignments = 0;
+            m_cache.reset_statistics();
         }
 
         // -----------------------
@@ -15,6 +15,7 @@ Author:
 #include "util/rlimit.h"
 #include "util/gparams.h"
 #include "util/mutex.h"
+#include "util/stopwatch.h"
 #include <iostream>
 #include <signal.h>
 #include "smt/params/smt_params_helper.hpp"
@@ -23,11 +24,18 @@ namespace {
 static mutex *display_stats_mux = new mutex;
 
 static lp::lp_solver<double, double>* g_solver = nullptr;
+static stopwatch g_stopwatch;
 
 static void display_statistics() {
     lock_guard lock(*display_stats_mux);
     if (g_solver && g_solver->settings().print_statistics) {
-        // TBD display relevant information about statistics
+        lp::statistics const& st = g_solver->settings().stats();
+        std::cout << "(lp-stats"
+                  << " :iterations " << st.m_total_iterations
+                  << " :factorizations " << st.m_num_factorizations
+                  << " :lu-updates " << st.m_num_lu_updates
+                  << " :refactor-interval " << g_solver->settings().refactor_interval
+                  << " :time " << g_stopwatch.get_current_seconds() << ")" << std::endl;
     }
 }
 
@@ -81,6 +89,8 @@ void run_solver(smt_params_helper & params, char const * mps_file_name) {
     solver->settings().report_frequency = params.arith_rep_freq();
     solver->settings().print_statistics = params.arith_print_stats();
     solver->settings().simplex_strategy() = lp:: simplex_strategy_enum::lu;
+    solver->settings().refactor_interval = std::max(1u, params.arith_refactor_interval());
+    g_stopwatch.start();
 
     solver->find_maximal_solution();
 
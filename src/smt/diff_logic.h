@@ -283,6 +283,8 @@ public:
 
     bool is_enabled(edge_id id) const { return m_edges[id].is_enabled(); }
 
+    edge_id_vector const& get_enabled_edges() const { return m_enabled_edges; }
+
     bool is_feasible(edge_id id) const { return is_feasible(m_edges[id]); }
 
     numeral const& get_weight(edge_id id) const { return m_edges[id].get_weight(); }
@@ -162,10 +162,44 @@ namespace smt {
         }
     };
 
+    void dyn_ack_sketch::init(unsigned log_width) {
+        m_log_width = std::min(log_width, 24u);
+        m_counts.reset();
+    }
+
+    unsigned dyn_ack_sketch::index(unsigned row, unsigned h) const {
+        unsigned mask = (1u << m_log_width) - 1;
+        return (row << m_log_width) + (mk_mix(h, row, 0x9e3779b9) & mask);
+    }
+
+    unsigned dyn_ack_sketch::inc(unsigned h) {
+        SASSERT(enabled());
+        if (m_counts.empty())
+            m_counts.resize(c_num_rows << m_log_width, 0);
+        unsigned min_count = UINT16_MAX;
+        for (unsigned row = 0; row < c_num_rows; ++row)
+            min_count = std::min<unsigned>(min_count, m_counts[index(row, h)]);
+        if (min_count == UINT16_MAX)
+            return min_count;
+        // conservative update: only increment the counters that determine the estimate.
+        for (unsigned row = 0; row < c_num_rows; ++row) {
+            uint16_t & c = m_counts[index(row, h)];
+            if (c == min_count)
+                c++;
+        }
+        return min_count + 1;
+    }
+
+    void dyn_ack_sketch::decay(double f) {
+        for (uint16_t & c : m_counts)
+            c = static_cast<uint16_t>(c * f);
+    }
+
     dyn_ack_manager::dyn_ack_manager(context & ctx, dyn_ack_params & p):
         m_context(ctx),
         m(ctx.get_manager()),
-        m_params(p) {
+        m_params(p),
+        m_threshold(p.m_dack_threshold) {
     }
 
     dyn_ack_manager::~dyn_ack_manager() {
@@ -189,11 +223,14 @@ namespace smt {
         m_qhead = 0;
         m_num_instances = 0;
         m_num_propagations_since_last_gc = 0;
+        m_threshold = m_params.m_dack_threshold;
+        m_sketch.init(m_params.m_dack_sketch_bits);
 
         m_triple.m_app2num_occs.reset();
         reset_app_triples();
         m_triple.m_to_instantiate.reset();
         m_triple.m_qhead = 0;
+        m_triple.m_sketch.init(m_params.m_dack_sketch_bits);
     }
 
     void dyn_ack_manager::cg_eh(app * n1, app * n2) {
@@ -210,12 +247,20 @@ namespace smt {
             return;
         }
         unsigned num_occs = 0;
+        bool is_new = false;
         if (m_app_pair2num_occs.find(n1, n2, num_occs)) {
             TRACE("dyn_ack", tout << "used_cg_eh:\n" << mk_pp(n1, m) << "\n" << mk_pp(n2, m) << "\nnum_occs: " << num_occs << "\n";);
             num_occs++;
         }
         else {
             num_occs = 1;
+            if (m_sketch.enabled()) {
+                // the pair is tracked exactly only once its approximate count reaches the threshold.
+                num_occs = m_sketch.inc(hash_u_u(n1->get_id(), n2->get_id()));
+                if (num_occs < m_threshold)
+                    return;
+            }
+            is_new = true;
             m.inc_ref(n1);
             m.inc_ref(n2);
             m_app_pairs.push_back(p);
@@ -226,7 +271,7 @@ namespace smt {
         unsigned num_occs2 = 0;
         SASSERT(m_app_pair2num_occs.find(n1, n2, num_occs2) && num_occs == num_occs2);
 #endif
-        if (num_occs == m_params.m_dack_threshold) {
+        if (num_occs == m_threshold || (is_new && num_occs > m_threshold)) {
             TRACE("dyn_ack", tout << "found candidate:\n" << mk_pp(n1, m) << "\n" << mk_pp(n2, m) << "\nnum_occs: " << num_occs << "\n";);
             m_to_instantiate.push_back(p);
         }
@@ -245,6 +290,7 @@ namespace smt {
             return;
         }
         unsigned num_occs = 0;
+        bool is_new = false;
         if (m_triple.m_app2num_occs.find(n1, n2, r, num_occs)) {
             TRACE("dyn_ack", tout << mk_pp(n1, m) << "\n" << mk_pp(n2, m) << "\n"
                   << mk_pp(r, m) << "\n" << "\nnum_occs: " << num_occs << "\n";);
@@ -252,6 +298,12 @@ namespace smt {
         }
         else {
             num_occs = 1;
+            if (m_triple.m_sketch.enabled()) {
+                num_occs = m_triple.m_sketch.inc(mk_mix(n1->get_id(), n2->get_id(), r->get_id()));
+                if (num_occs < m_threshold)
+                    return;
+            }
+            is_new = true;
             m.inc_ref(n1);
             m.inc_ref(n2);
             m.inc_ref(r);
@@ -263,7 +315,7 @@ namespace smt {
         unsigned num_occs2 = 0;
         SASSERT(m_triple.m_app2num_occs.find(n1, n2, r, num_occs2) && num_occs == num_occs2);
 #endif
-        if (num_occs == m_params.m_dack_threshold) {
+        if (num_occs == m_threshold || (is_new && num_occs > m_threshold)) {
             TRACE("dyn_ack", tout << "found candidate:\n" << mk_pp(n1, m) << "\n" << mk_pp(n2, m) 
                   << "\n" << mk_pp(r, m) 
                   << "\nnum_occs: " << num_occs << "\n";);
@@ -292,9 +344,42 @@ namespace smt {
         }
     };
 
+    /**
+       \brief Adjust the instantiation threshold using the fraction of Ackermann
+       lemmas that participated in conflict resolution since they were created.
+       Lemmas that are used lower the threshold, lemmas that sit idle raise it.
+    */
+    void dyn_ack_manager::adapt_threshold() {
+        unsigned num_lemmas = 0, num_used = 0;
+        for (auto const& kv : m_clause2app_pair) {
+            num_lemmas++;
+            if (kv.m_key->get_activity() > 1)
+                num_used++;
+        }
+        for (auto const& kv : m_triple.m_clause2apps) {
+            num_lemmas++;
+            if (kv.m_key->get_activity() > 1)
+                num_used++;
+        }
+        if (num_lemmas < 10)
+            return;
+        unsigned min_threshold = std::min(2u, m_params.m_dack_threshold);
+        unsigned max_threshold = 4 * m_params.m_dack_threshold;
+        if (2 * num_used >= num_lemmas && m_threshold > min_threshold)
+            m_threshold--;
+        else if (10 * num_used < num_lemmas && m_threshold < max_threshold)
+            m_threshold++;
+        TRACE("dyn_ack", tout << "used " << num_used << " of " << num_lemmas << " lemmas, threshold: " << m_threshold << "\n";);
+    }
+
     void dyn_ack_manager::gc() {
         TRACE("dyn_ack", tout << "dyn_ack GC\n";);
         unsigned num_deleted = 0;
+        if (m_params.m_dack_adaptive)
+            adapt_threshold();
+        m_sketch.decay(m_params.m_dack_gc_inv_decay);
+        // the exact triple tables are not collected, but their sketch ages with the pairs.
+        m_triple.m_sketch.decay(m_params.m_dack_gc_inv_decay);
         m_to_instantiate.reset();
         m_qhead = 0;
         svector<app_pair>::iterator it  = m_app_pairs.begin();
@@ -329,7 +414,7 @@ namespace smt {
             ++it2;
             SASSERT(num_occs > 0);
             m_app_pair2num_occs.insert(p.first, p.second, num_occs);
-            if (num_occs >= m_params.m_dack_threshold)
+            if (num_occs >= m_threshold)
                 m_to_instantiate.push_back(p);
         }
         m_app_pairs.set_end(it2);
@@ -380,6 +465,17 @@ namespace smt {
             gc();
             m_num_propagations_since_last_gc = 0;
         }
+        if (!m_params.m_dack_restart)
+            instantiate_pending();
+    }
+
+    void dyn_ack_manager::restart_eh() {
+        if (m_params.m_dack == dyn_ack_strategy::DACK_DISABLED || !m_params.m_dack_restart)
+            return;
+        instantiate_pending();
+    }
+
+    void dyn_ack_manager::instantiate_pending() {
         unsigned max_instances  = static_cast<unsigned>(m_context.get_num_conflicts() * m_params.m_dack_factor);
         while (m_num_instances < max_instances && m_qhead < m_to_instantiate.size()) {
             app_pair & p = m_to_instantiate[m_qhead];
@@ -556,7 +652,7 @@ namespace smt {
             ++it2;
             SASSERT(num_occs > 0);
             m_triple.m_app2num_occs.insert(p.first, p.second, p.third, num_occs);
-            if (num_occs >= m_params.m_dack_threshold)
+            if (num_occs >= m_threshold)
                 m_triple.m_to_instantiate.push_back(p);
         }
         m_triple.m_apps.set_end(it2);
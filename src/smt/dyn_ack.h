@@ -29,6 +29,27 @@ namespace smt {
 
     class context;
 
+    /**
+       \brief Count-min sketch approximating how often congruences between
+       pairs (and triples) of applications are used. Estimates never undercount,
+       so no candidate is missed, but memory does not grow with the number of
+       distinct pairs seen during search.
+    */
+    class dyn_ack_sketch {
+        static const unsigned c_num_rows = 4;
+        unsigned          m_log_width = 0;
+        svector<uint16_t> m_counts;
+        unsigned index(unsigned row, unsigned h) const;
+    public:
+        void init(unsigned log_width);
+        bool enabled() const { return m_log_width > 0; }
+        /**
+           \brief Increment the count for hash code h and return its new estimate.
+        */
+        unsigned inc(unsigned h);
+        void decay(double f);
+    };
+
     class dyn_ack_manager {
         typedef std::pair<app *, app *>           app_pair;
         typedef obj_pair_map<app, app, unsigned>  app_pair2num_occs;
@@ -53,6 +74,8 @@ namespace smt {
         unsigned                                   m_num_propagations_since_last_gc;
         app_pair_set                               m_instantiated;
         clause2app_pair                            m_clause2app_pair;
+        dyn_ack_sketch                             m_sketch;
+        unsigned                                   m_threshold;
 
         struct _triple {
             app_triple2num_occs                    m_app2num_occs;
@@ -63,6 +86,7 @@ namespace smt {
             unsigned                               m_num_propagations_since_last_gc;
             app_triple_set                         m_instantiated;
             clause2app_triple                      m_clause2apps;
+            dyn_ack_sketch                         m_sketch; // separate from pairs so their counts do not collide
         };
         _triple                                    m_triple;
         
@@ -80,6 +104,8 @@ namespace smt {
         void instantiate(app * n1, app * n2, app* r);
         void reset_app_triples();
         void gc_triples();
+        void adapt_threshold();
+        void instantiate_pending();
         
     public:
         dyn_ack_manager(context & ctx, dyn_ack_params & p);
@@ -123,6 +149,12 @@ namespace smt {
         */
         void propagate_eh();
 
+        /**
+           \brief This method is invoked after a restart. When dack.restart is set,
+           pending Ackermann lemmas are expanded here instead of in propagate_eh.
+        */
+        void restart_eh();
+
         void reset();
 
 #ifdef Z3DEBUG
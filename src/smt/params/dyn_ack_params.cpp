@@ -27,6 +27,9 @@ void dyn_ack_params::updt_params(params_ref const & _p) {
     m_dack_threshold = p.dack_threshold();
     m_dack_gc = p.dack_gc();
     m_dack_gc_inv_decay = p.dack_gc_inv_decay();
+    m_dack_sketch_bits = p.dack_sketch_bits();
+    m_dack_adaptive = p.dack_adaptive();
+    m_dack_restart = p.dack_restart();
 }
 
 #define DISPLAY_PARAM(X) out << #X"=" << X << std::endl;
@@ -38,4 +41,7 @@ void dyn_ack_params::display(std::ostream & out) const {
     DISPLAY_PARAM(m_dack_threshold);
     DISPLAY_PARAM(m_dack_gc);
     DISPLAY_PARAM(m_dack_gc_inv_decay);
+    DISPLAY_PARAM(m_dack_sketch_bits);
+    DISPLAY_PARAM(m_dack_adaptive);
+    DISPLAY_PARAM(m_dack_restart);
 }
\ No newline at end of file
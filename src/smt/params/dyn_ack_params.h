@@ -33,6 +33,9 @@ struct dyn_ack_params {
     unsigned         m_dack_threshold = 10;
     unsigned         m_dack_gc = 2000;
     double           m_dack_gc_inv_decay = 0.8;
+    unsigned         m_dack_sketch_bits = 0;
+    bool             m_dack_adaptive = false;
+    bool             m_dack_restart = false;
 
 public:
     dyn_ack_params(params_ref const & p = params_ref()) {
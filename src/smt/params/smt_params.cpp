@@ -48,7 +48,10 @@ void smt_params::updt_local_params(params_ref const & _p) {
     m_threads       = p.threads();
     m_threads_max_conflicts  = p.threads_max_conflicts();
     m_threads_cube_frequency = p.threads_cube_frequency();
+    m_local_search = p.local_search();
+    m_local_search_restarts = p.local_search_restarts();
     m_core_validate = p.core_validate();
+    m_fp_lazy_blast = p.fp_lazy_blast();
     m_logic = _p.get_sym("logic", m_logic);
     m_string_solver = p.string_solver();
     validate_string_solver(m_string_solver);
@@ -119,6 +122,8 @@ void smt_params::display(std::ostream & out) const {
     DISPLAY_PARAM(m_threads);
     DISPLAY_PARAM(m_threads_max_conflicts);
     DISPLAY_PARAM(m_threads_cube_frequency);
+    DISPLAY_PARAM(m_local_search);
+    DISPLAY_PARAM(m_local_search_restarts);
     DISPLAY_PARAM(m_simplify_clauses);
     DISPLAY_PARAM(m_tick);
     DISPLAY_PARAM(m_display_features);
@@ -164,6 +169,8 @@ void smt_params::display(std::ostream & out) const {
     DISPLAY_PARAM(m_display_bool_var2expr);
     DISPLAY_PARAM(m_display_ll_bool_var2expr);
 
+    DISPLAY_PARAM(m_fp_lazy_blast);
+
     DISPLAY_PARAM(m_model);
     DISPLAY_PARAM(m_model_on_timeout);
     DISPLAY_PARAM(m_model_on_final_check);
@@ -69,7 +69,8 @@ enum case_split_strategy {
     CS_RELEVANCY, // case split based on relevancy
     CS_RELEVANCY_ACTIVITY, // case split based on relevancy and activity
     CS_RELEVANCY_GOAL, // based on relevancy and the current goal
-    CS_ACTIVITY_THEORY_AWARE_BRANCHING // activity-based case split, but theory solvers can manipulate activity
+    CS_ACTIVITY_THEORY_AWARE_BRANCHING, // activity-based case split, but theory solvers can manipulate activity
+    CS_ACTIVITY_SCORED // case split based on priorities given by a case_split_scorer, and activity
 };
 
 struct smt_params : public preprocessor_params,
@@ -105,6 +106,8 @@ struct smt_params : public preprocessor_params,
     unsigned         m_threads = 1;
     unsigned         m_threads_max_conflicts = UINT_MAX;
     unsigned         m_threads_cube_frequency = 2;
+    bool             m_local_search = false;
+    unsigned         m_local_search_restarts = 8;
     bool             m_simplify_clauses = true;
     unsigned         m_tick = 1000;
     bool             m_display_features = false;
@@ -187,6 +190,13 @@ struct smt_params : public preprocessor_params,
     bool              m_display_bool_var2expr = false;
     bool              m_display_ll_bool_var2expr = false;
 
+    // -----------------------------------
+    //
+    // Floating-point
+    //
+    // -----------------------------------
+    bool             m_fp_lazy_blast = false;
+
     // -----------------------------------
     //
     // Model generation
@@ -34,6 +34,7 @@ void theory_arith_params::updt_params(params_ref const & _p) {
     m_arith_int_eq_branching = p.arith_int_eq_branch();
     m_arith_ignore_int = p.arith_ignore_int();
     m_arith_bound_prop = static_cast<bound_prop_mode>(p.arith_propagation_mode());
+    m_arith_dl_implied_edges = p.arith_dl_implied_edges();
     m_arith_eager_eq_axioms = p.arith_eager_eq_axioms();
     m_arith_auto_config_simplex = p.arith_auto_config_simplex();
 
@@ -76,6 +77,7 @@ void theory_arith_params::display(std::ostream & out) const {
     DISPLAY_PARAM(m_arith_propagation_threshold);
     DISPLAY_PARAM(m_arith_pivot_strategy);
     DISPLAY_PARAM(m_arith_add_binary_bounds);
+    DISPLAY_PARAM(m_arith_dl_implied_edges);
     DISPLAY_PARAM((unsigned)m_arith_propagation_strategy);
     DISPLAY_PARAM(m_arith_eq_bounds);
     DISPLAY_PARAM(m_arith_lazy_adapter);
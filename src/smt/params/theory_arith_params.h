@@ -86,6 +86,7 @@ struct theory_arith_params {
 
     // used in diff-logic
     bool                    m_arith_add_binary_bounds = false;
+    bool                    m_arith_dl_implied_edges = false;
     arith_prop_strategy     m_arith_propagation_strategy = arith_prop_strategy::ARITH_PROP_PROPORTIONAL;
 
     // used arith_eq_adapter
@@ -33,6 +33,7 @@ void theory_str_params::updt_params(params_ref const & _p) {
     m_RegexAutomata_FailedAutomatonThreshold = p.str_regex_automata_failed_automaton_threshold();
     m_RegexAutomata_FailedIntersectionThreshold = p.str_regex_automata_failed_intersection_threshold();
     m_RegexAutomata_LengthAttemptThreshold = p.str_regex_automata_length_attempt_threshold();
+    m_RegexAutomata_CacheMaxStates = p.str_regex_automata_cache_max_states();
     m_FixedLengthRefinement = p.str_fixed_length_refinement();
     m_FixedLengthNaiveCounterexamples = p.str_fixed_length_naive_cex();
 }
@@ -53,5 +54,6 @@ void theory_str_params::display(std::ostream & out) const {
     DISPLAY_PARAM(m_RegexAutomata_FailedAutomatonThreshold);
     DISPLAY_PARAM(m_RegexAutomata_FailedIntersectionThreshold);
     DISPLAY_PARAM(m_RegexAutomata_LengthAttemptThreshold);
+    DISPLAY_PARAM(m_RegexAutomata_CacheMaxStates);
     DISPLAY_PARAM(m_FixedLengthNaiveCounterexamples);
 }
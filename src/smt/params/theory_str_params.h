@@ -98,6 +98,13 @@ struct theory_str_params {
      * before which we begin checking unsatisfiability of a regex term.
      */
     unsigned m_RegexAutomata_LengthAttemptThreshold = 10;
+
+    /*
+     * RegexAutomata_CacheMaxStates is the total number of automaton states Z3str3 keeps
+     * in its cache of regex automata and automaton intersections across searches.
+     */
+    unsigned m_RegexAutomata_CacheMaxStates = 100000;
+
     /*
      * If FixedLengthRefinement is true and the fixed-length equation solver is enabled,
      * Z3str3 will use abstraction refinement to handle formulas that would result in disjunctions or expensive
@@ -24,6 +24,7 @@ Revision History:
 #include "ast/ast_pp.h"
 #include "util/map.h"
 #include "util/hashtable.h"
+#include "util/dary_heap.h"
 
 using namespace smt;
 
@@ -62,6 +63,19 @@ namespace {
 
     typedef heap<theory_aware_act_lt> theory_aware_act_queue;
 
+    struct bool_var_priority_act_lt {
+        svector<double> const &        m_activity;
+        svector<unsigned char> const & m_priority;
+        bool_var_priority_act_lt(svector<double> const & a, svector<unsigned char> const & p):m_activity(a), m_priority(p) {}
+        bool operator()(bool_var v1, bool_var v2) const {
+            if (m_priority[v1] != m_priority[v2])
+                return m_priority[v1] > m_priority[v2];
+            return m_activity[v1] > m_activity[v2];
+        }
+    };
+
+    typedef dary_heap<bool_var_priority_act_lt> bool_var_priority_queue;
+
     /**
        \brief Case split queue based on activity and random splits.
     */
@@ -1243,9 +1257,141 @@ namespace {
 
         }
     };
+
+    /**
+       \brief Case split queue based on priorities given by a case_split_scorer and activity.
+
+       Priorities are bucketed into 256 levels, so the queue is a single
+       d-ary heap ordered lexicographically by (priority, activity).
+       Without a scorer all variables have the same priority, and the queue
+       behaves as act_case_split_queue.
+    */
+    class scored_case_split_queue : public case_split_queue {
+        context &               m_context;
+        smt_params &            m_params;
+        case_split_scorer *     m_scorer;
+        svector<unsigned char>  m_priority;
+        bool_var_priority_queue m_queue;
+
+        unsigned char get_priority(bool_var v) {
+            expr * atom = m_context.bool_var2expr(v);
+            if (!m_scorer || !atom)
+                return 0;
+            double p = m_scorer->priority(v, atom);
+            if (!(p > 0.0))
+                return 0;
+            if (p >= 1.0)
+                return 255;
+            return static_cast<unsigned char>(p * 255.0);
+        }
+
+    public:
+        scored_case_split_queue(context & ctx, smt_params & p):
+            m_context(ctx),
+            m_params(p),
+            m_scorer(nullptr),
+            m_queue(1024, bool_var_priority_act_lt(ctx.get_activity_vector(), m_priority)) {
+        }
+
+        void activity_increased_eh(bool_var v) override {
+            if (m_queue.contains(v))
+                m_queue.decreased(v);
+        }
+
+        void activity_decreased_eh(bool_var v) override {
+            if (m_queue.contains(v))
+                m_queue.increased(v);
+        }
+
+        void mk_var_eh(bool_var v) override {
+            m_queue.reserve(v+1);
+            m_priority.reserve(v+1, 0);
+            m_priority[v] = get_priority(v);
+            if (!m_queue.contains(v))
+                m_queue.insert(v);
+        }
+
+        void del_var_eh(bool_var v) override {
+            if (m_queue.contains(v))
+                m_queue.erase(v);
+        }
+
+        void unassign_var_eh(bool_var v) override {
+            if (!m_queue.contains(v))
+                m_queue.insert(v);
+        }
+
+        void relevant_eh(expr * n) override {}
+
+        void init_search_eh() override {}
+
+        void end_search_eh() override {}
+
+        void reset() override {
+            m_queue.reset();
+        }
+
+        void push_scope() override {}
+
+        void pop_scope(unsigned num_scopes) override {}
+
+        bool set_scorer(case_split_scorer * s) override {
+            m_scorer = s;
+            svector<bool_var> vars;
+            for (bool_var v : m_queue)
+                vars.push_back(v);
+            m_queue.reset();
+            for (bool_var v = 0; v < static_cast<bool_var>(m_priority.size()); ++v)
+                m_priority[v] = get_priority(v);
+            for (bool_var v : vars)
+                m_queue.insert(v);
+            return true;
+        }
+
+        void next_case_split(bool_var & next, lbool & phase) override {
+            phase = l_undef;
+            
+            if (m_context.get_random_value() < static_cast<int>(m_params.m_random_var_freq * random_gen::max_value())) {
+                next = m_context.get_random_value() % m_context.get_num_b_internalized(); 
+                TRACE("random_split", tout << "next: " << next << " get_assignment(next): " << m_context.get_assignment(next) << "\n";);
+                if (m_context.get_assignment(next) == l_undef)
+                    return;
+            }
+            
+            while (!m_queue.empty()) {
+                next = m_queue.erase_min();
+                if (m_context.get_assignment(next) == l_undef) {
+                    if (m_scorer)
+                        phase = m_scorer->phase(next, m_context.bool_var2expr(next));
+                    return;
+                }
+            }
+            
+            next = null_bool_var;
+        }
+
+        void display(std::ostream & out) override {
+            bool first = true;
+            for (unsigned v : m_queue) {
+                if (m_context.get_assignment(v) == l_undef) {
+                    if (first) {
+                        out << "remaining case-splits:\n";
+                        first = false;
+                    }
+                    out << "#" << m_context.bool_var2expr(v)->get_id() << ":" << static_cast<unsigned>(m_priority[v]) << " ";
+                }
+            }
+            if (!first)
+                out << "\n";            
+        }
+    };
 }
 
 namespace smt {
+    case_split_queue * mk_scored_case_split_queue(context & ctx, smt_params & p) {
+        return alloc(scored_case_split_queue, ctx, p);
+    }
+
     case_split_queue * mk_case_split_queue(context & ctx, smt_params & p) {
         if (ctx.relevancy_lvl() < 2 && (p.m_case_split_strategy == CS_RELEVANCY || p.m_case_split_strategy == CS_RELEVANCY_ACTIVITY || 
                                         p.m_case_split_strategy == CS_RELEVANCY_GOAL)) {
@@ -1270,6 +1416,8 @@ namespace smt {
             return alloc(rel_goal_case_split_queue, ctx, p);
         case CS_ACTIVITY_THEORY_AWARE_BRANCHING:
             return alloc(theory_aware_branching_queue, ctx, p);
+        case CS_ACTIVITY_SCORED:
+            return alloc(scored_case_split_queue, ctx, p);
         default:
             return alloc(act_case_split_queue, ctx, p);
         }
@@ -25,6 +25,28 @@ Revision History:
 namespace smt {
     class context;
 
+    /**
+       \brief Plug-in scoring function for case splits, e.g., priors computed by an external model.
+
+       The priority of a Boolean variable is requested when the variable is created.
+       Variables with higher priority are split on first, and the variable activity
+       breaks ties between variables of the same priority.
+    */
+    class case_split_scorer {
+    public:
+        virtual ~case_split_scorer() = default;
+
+        /**
+           \brief Return the priority of v (associated with atom), a value in [0, 1].
+        */
+        virtual double priority(bool_var v, expr * atom) = 0;
+
+        /**
+           \brief Return the preferred phase of v, or l_undef to use the phase selection heuristic.
+        */
+        virtual lbool phase(bool_var v, expr * atom) { return l_undef; }
+    };
+
     /**
        \brief Abstract case split queue.
     */
@@ -49,9 +71,16 @@ namespace smt {
 
         // theory-aware branching hint
         virtual void add_theory_aware_branching_info(bool_var v, double priority, lbool phase) {}
+
+        /**
+           \brief Use the given scoring function. Return false if the queue does not support scoring functions.
+        */
+        virtual bool set_scorer(case_split_scorer * s) { return false; }
     };
 
     case_split_queue * mk_case_split_queue(context & ctx, smt_params & p);
+
+    case_split_queue * mk_scored_case_split_queue(context & ctx, smt_params & p);
 };
 
 
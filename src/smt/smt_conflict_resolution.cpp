@@ -642,6 +642,10 @@ namespace smt {
         bool_var var = antecedent.var();
         unsigned lvl = m_ctx.get_assign_level(var);
         if (!m_ctx.is_marked(var) && lvl > m_ctx.get_base_level()) {
+            if (is_min_failed(var)) {
+                m_ctx.m_stats.m_num_minimize_cache_hits++;
+                return false;
+            }
             if (m_lvl_set.may_contain(lvl)) {
                 m_ctx.set_mark(var);
                 m_unmark.push_back(var);
@@ -667,22 +671,38 @@ namespace smt {
         return true;
     }
 
+    /**
+       \brief Record that the search started at root failed while processing
+       the justification of var. Both variables are not implied by the marked
+       literals, so later searches of the same minimization stop when they reach them.
+    */
+    bool conflict_resolution::minimization_failed(bool_var root, bool_var var, unsigned old_size, unsigned old_js_qhead) {
+        set_min_failed(root);
+        set_min_failed(var);
+        reset_unmark_and_justifications(old_size, old_js_qhead);
+        return false;
+    }
+
     /**
        \brief Return true if lit is implied by other marked literals
        and/or literals assigned at the base level.
        The set lvl_set is used as an optimization.
        The idea is to stop the recursive search with a failure
        as soon as we find a literal assigned in a level that is not in lvl_set.
+       Variables that failed earlier searches of the same minimization also 
+       stop the search with a failure.
     */
     bool conflict_resolution::implied_by_marked(literal lit) {
         m_lemma_min_stack.reset();  // avoid recursive function
         m_lemma_min_stack.push_back(lit.var());
         unsigned old_size     = m_unmark.size();
         unsigned old_js_qhead = m_todo_js_qhead;
+        bool_var root         = lit.var();
 
         while (!m_lemma_min_stack.empty()) {
             bool_var var       = m_lemma_min_stack.back();
             m_lemma_min_stack.pop_back();
+            m_ctx.m_stats.m_num_minimize_steps++;
             b_justification js = m_ctx.get_justification(var);
             SASSERT(js != null_b_justification);
             switch(js.get_kind()) {
@@ -694,37 +714,27 @@ namespace smt {
                     if (pos != i) {
                         literal l = (*cls)[i];
                         SASSERT(l.var() != var);
-                        if (!process_antecedent_for_minimization(~l)) {
-                            reset_unmark_and_justifications(old_size, old_js_qhead);
-                            return false;
-                        }
+                        if (!process_antecedent_for_minimization(~l)) 
+                            return minimization_failed(root, var, old_size, old_js_qhead);
                     }
                 }
                 justification * js = cls->get_justification();
-                if (js && !process_justification_for_minimization(js)) {
-                    reset_unmark_and_justifications(old_size, old_js_qhead);
-                    return false;
-                }
+                if (js && !process_justification_for_minimization(js)) 
+                    return minimization_failed(root, var, old_size, old_js_qhead);
                 break;
             }
             case b_justification::BIN_CLAUSE:
-                if (!process_antecedent_for_minimization(js.get_literal())) {
-                    reset_unmark_and_justifications(old_size, old_js_qhead);
-                    return false;
-                }
+                if (!process_antecedent_for_minimization(js.get_literal())) 
+                    return minimization_failed(root, var, old_size, old_js_qhead);
                 break;
             case b_justification::AXIOM:
                 // it is a decision variable from a previous scope level or an assumption
-                if (m_ctx.get_assign_level(var) > m_ctx.get_base_level()) {
-                    reset_unmark_and_justifications(old_size, old_js_qhead);
-                    return false;
-                }
+                if (m_ctx.get_assign_level(var) > m_ctx.get_base_level()) 
+                    return minimization_failed(root, var, old_size, old_js_qhead);
                 break;
             case b_justification::JUSTIFICATION:
-                if (m_ctx.is_assumption(var) || !process_justification_for_minimization(js.get_justification())) {
-                    reset_unmark_and_justifications(old_size, old_js_qhead);
-                    return false;
-                }
+                if (m_ctx.is_assumption(var) || !process_justification_for_minimization(js.get_justification())) 
+                    return minimization_failed(root, var, old_size, old_js_qhead);
                 break;
             }
         }
@@ -740,10 +750,15 @@ namespace smt {
         m_unmark.reset();
 
         m_lvl_set   = get_lemma_approx_level_set();
+        if (++m_min_stamp == 0) {
+            m_min_failed.reset();
+            m_min_stamp = 1;
+        }
 
         unsigned sz   = m_lemma.size();
         unsigned i    = 1; // the first literal is the FUIP
         unsigned j    = 1;
+        unsigned num_steps = m_ctx.m_stats.m_num_minimize_steps;
         for (; i < sz; i++) {
             literal l = m_lemma[i];
             if (implied_by_marked(l)) {
@@ -762,7 +777,8 @@ namespace smt {
         m_lemma      .shrink(j);
         m_lemma_atoms.shrink(j);
         m_ctx.m_stats.m_num_minimized_lits += sz - j;
-        TRACE("conflict", tout << "lemma: " << m_lemma << "\n";);
+        TRACE("conflict", tout << "lemma: " << m_lemma << "\n";
+              tout << "minimization removed " << (sz - j) << " literals in " << (m_ctx.m_stats.m_num_minimize_steps - num_steps) << " steps\n";);
     }
 
     /**
@@ -182,6 +182,13 @@ namespace smt {
         bool_var_vector m_unmark;
         bool_var_vector m_lemma_min_stack;
         level_approx_set m_lvl_set;
+        // m_min_failed[v] == m_min_stamp if v is known not to be implied by the 
+        // marked literals during the current lemma minimization.
+        unsigned_vector m_min_failed;
+        unsigned        m_min_stamp { 0 };
+        bool is_min_failed(bool_var v) const { return v < m_min_failed.size() && m_min_failed[v] == m_min_stamp; }
+        void set_min_failed(bool_var v) { m_min_failed.reserve(v + 1, 0); m_min_failed[v] = m_min_stamp; }
+        bool minimization_failed(bool_var root, bool_var var, unsigned old_size, unsigned old_js_qhead);
         level_approx_set get_lemma_approx_level_set();
         void reset_unmark(unsigned old_size);
         void reset_unmark_and_justifications(unsigned old_size, unsigned old_js_qhead);
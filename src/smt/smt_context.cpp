@@ -3097,6 +3097,16 @@ namespace smt {
         m_case_split_queue->add_theory_aware_branching_info(v, priority, phase);
     }
 
+    void context::set_case_split_scorer(case_split_scorer * s) {
+        m_case_split_scorer = s;
+        if (m_case_split_queue->set_scorer(s))
+            return;
+        m_case_split_queue = mk_scored_case_split_queue(*this, m_fparams);
+        for (bool_var v = 0; v < static_cast<bool_var>(get_num_bool_vars()); ++v) 
+            m_case_split_queue->mk_var_eh(v);
+        VERIFY(m_case_split_queue->set_scorer(s));
+    }
+
     void context::undo_th_case_split(literal l) {
         m_all_th_case_split_literals.remove(l.index());
         if (m_literal2casesplitsets.contains(l.index())) {
@@ -3799,6 +3809,8 @@ namespace smt {
             for (theory* th : m_theory_set) 
                 if (!inconsistent()) 
                     th->restart_eh();
+            if (!inconsistent())
+                m_dyn_ack_manager.restart_eh();
 
             TRACE("mbqi_bug_detail", tout << "before instantiating quantifiers...\n";);
             if (!inconsistent()) 
@@ -3813,6 +3825,16 @@ namespace smt {
                 m_last_search_failure = NUM_CONFLICTS;
                 return false;
             }
+            if (m_fparams.m_local_search && m_num_restarts % std::max(1u, m_fparams.m_local_search_restarts) == 0) {
+                if (!m_local_search)
+                    m_local_search = alloc(local_search, *this);
+                if ((*m_local_search)() == l_true) {
+                    IF_VERBOSE(2, verbose_stream() << "(smt.local-search :sat)\n");
+                    m_model = m_local_search->get_model().get();
+                    status = l_true;
+                    return false;
+                }
+            }
         }
         if (m_fparams.m_simplify_clauses)
             simplify_clauses();
@@ -38,6 +38,7 @@ Revision History:
 #include "smt/smt_failure.h"
 #include "smt/smt_types.h"
 #include "smt/dyn_ack.h"
+#include "smt/smt_local_search.h"
 #include "ast/ast_smt_pp.h"
 #include "smt/watch_list.h"
 #include "util/trail.h"
@@ -65,6 +66,7 @@ namespace smt {
     class context {
         friend class model_generator;
         friend class lookahead;
+        friend class local_search;
         friend class parallel;
     public:
         statistics                  m_stats;
@@ -182,6 +184,7 @@ namespace smt {
         unsigned                    m_qhead { 0 };
         unsigned                    m_simp_qhead { 0 };
         int                         m_simp_counter { 0 }; //!< can become negative
+        scoped_ptr<case_split_scorer> m_case_split_scorer;
         scoped_ptr<case_split_queue> m_case_split_queue;
         double                      m_bvar_inc { 1.0 };
         bool                        m_phase_cache_on { true };
@@ -204,6 +207,7 @@ namespace smt {
         obj_map<expr, unsigned>     m_cached_generation;
         obj_hashtable<expr>         m_cache_generation_visited;
         dyn_ack_manager             m_dyn_ack_manager;
+        scoped_ptr<local_search>    m_local_search;
 
         // -----------------------------------
         //
@@ -962,6 +966,13 @@ namespace smt {
 
     public:
 
+        /**
+           \brief Order case splits by the priorities given by s, breaking ties by activity.
+           The context takes ownership of s. If the configured case split queue does not 
+           support scoring functions, it is replaced by one that does (smt.case_split=7).
+        */
+        void set_case_split_scorer(case_split_scorer * s);
+
         // helper function for trail
         void undo_th_case_split(literal l);
 
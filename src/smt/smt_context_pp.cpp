@@ -421,10 +421,14 @@ namespace smt {
         st.update("interface eqs", m_stats.m_num_interface_eqs);
         st.update("max generation", m_stats.m_max_generation);
         st.update("minimized lits", m_stats.m_num_minimized_lits);
+        st.update("minimize steps", m_stats.m_num_minimize_steps);
+        st.update("minimize cache hits", m_stats.m_num_minimize_cache_hits);
         st.update("num checks", m_stats.m_num_checks);
         st.update("mk bool var", m_stats.m_num_mk_bool_var ? m_stats.m_num_mk_bool_var - 1 : 0);
         m_qmanager->collect_statistics(st);
         m_asserted_formulas.collect_statistics(st);
+        if (m_local_search)
+            m_local_search->collect_statistics(st);
         for (theory* th : m_theory_set) {
             th->collect_statistics(st);
         }
@@ -75,6 +75,10 @@ namespace smt {
         m_imp->m_kernel.set_progress_callback(callback);
     }
 
+    void kernel::set_case_split_scorer(case_split_scorer * s) {
+        m_imp->m_kernel.set_case_split_scorer(s);
+    }
+
     void kernel::assert_expr(expr * e) {
         m_imp->m_kernel.assert_expr(e);
     }
@@ -41,6 +41,7 @@ namespace smt {
 
     class enode;
     class context;
+    class case_split_scorer;
     
     class kernel {
         struct imp;
@@ -65,6 +66,11 @@ namespace smt {
         */
         void set_progress_callback(progress_callback * callback);
 
+        /**
+           \brief Set a scoring function for case splits. The kernel takes ownership of s.
+        */
+        void set_case_split_scorer(case_split_scorer * s);
+
         /**
            \brief Assert the given assetion into the logical context.
            This method uses the "asserted" proof as a justification for e.
@@ -0,0 +1,226 @@
+/*++
+Copyright (c) 2006 Microsoft Corporation
+
+Module Name:
+
+    smt_local_search.cpp
+
+Abstract:
+
+    Bit-vector local search invoked from the SMT search loop.
+
+Revision History:
+
+--*/
+
+#include "ast/for_each_expr.h"
+#include "ast/ast_pp.h"
+#include "ast/ast_ll_pp.h"
+#include "ast/normal_forms/defined_names.h"
+#include "ast/normal_forms/nnf.h"
+#include "model/model_evaluator.h"
+#include "tactic/sls/sls_engine.h"
+#include "smt/smt_local_search.h"
+#include "smt/smt_context.h"
+
+namespace smt {
+
+    local_search::local_search(context& ctx):
+        ctx(ctx),
+        m(ctx.get_manager()),
+        m_bv(m),
+        m_formulas(m),
+        m_nnf(m),
+        m_decls(m) {}
+
+    /**
+       \brief check that sls_engine can evaluate and score the term e.
+       The arguments of e are checked separately.
+    */
+    bool local_search::is_supported(expr* e) const {
+        if (!is_app(e))
+            return false;
+        app* a = to_app(e);
+        sort* s = a->get_sort();
+        if (!m.is_bool(s) && !m_bv.is_bv_sort(s))
+            return false;
+        if (is_uninterp_const(a))
+            return true;
+        if (m_bv.is_numeral(a))
+            return true;
+        if (a->get_family_id() == m.get_basic_family_id()) {
+            switch (a->get_decl_kind()) {
+            case OP_AND:
+            case OP_OR:
+            case OP_EQ:
+            case OP_DISTINCT:
+            case OP_ITE:
+                return true;
+            case OP_NOT:
+                // the score of a negation is defined only on formulas in negation normal form
+                return !m.is_and(a->get_arg(0)) && !m.is_or(a->get_arg(0));
+            default:
+                return false;
+            }
+        }
+        if (a->get_family_id() == m_bv.get_family_id()) {
+            switch (a->get_decl_kind()) {
+            case OP_ULEQ:
+            case OP_SLEQ:
+            case OP_CONCAT:
+            case OP_EXTRACT:
+            case OP_SIGN_EXT:
+            case OP_BADD:
+            case OP_BSUB:
+            case OP_BMUL:
+            case OP_BNEG:
+            case OP_BSDIV:
+            case OP_BSDIV_I:
+            case OP_BUDIV:
+            case OP_BUDIV_I:
+            case OP_BSREM:
+            case OP_BSREM_I:
+            case OP_BUREM:
+            case OP_BUREM_I:
+            case OP_BSMOD:
+            case OP_BSMOD_I:
+            case OP_BAND:
+            case OP_BOR:
+            case OP_BXOR:
+            case OP_BNAND:
+            case OP_BNOR:
+            case OP_BNOT:
+            case OP_BSHL:
+            case OP_BLSHR:
+            case OP_BASHR:
+                return true;
+            default:
+                return false;
+            }
+        }
+        return false;
+    }
+
+    /**
+       \brief collect the asserted formulas and their negation normal form.
+       Return false if they are outside of the fragment supported by sls_engine.
+    */
+    bool local_search::init() {
+        m_formulas.reset();
+        m_nnf.reset();
+        m_decls.reset();
+        asserted_formulas& af = ctx.m_asserted_formulas;
+        for (unsigned i = 0; i < af.get_num_formulas(); ++i)
+            m_formulas.push_back(af.get_formula(i));
+        if (m_formulas.empty())
+            return false;
+
+        params_ref p;
+        p.set_sym("mode", symbol("full"));
+        defined_names dnames(m);
+        nnf to_nnf(m, dnames, p);
+        expr_ref_vector defs(m);
+        proof_ref_vector def_prs(m);
+        expr_ref r(m);
+        proof_ref pr(m);
+        for (expr* f : m_formulas) {
+            to_nnf(f, defs, def_prs, r, pr);
+            m_nnf.push_back(r);
+        }
+        m_nnf.append(defs);
+
+        for (expr* t : subterms::all(m_nnf))
+            if (!is_supported(t))
+                return false;
+
+        ast_mark visited;
+        for (expr* t : subterms::all(m_formulas)) {
+            if (is_uninterp_const(t) && !visited.is_marked(to_app(t)->get_decl())) {
+                visited.mark(to_app(t)->get_decl(), true);
+                m_decls.push_back(to_app(t)->get_decl());
+            }
+        }
+        return true;
+    }
+
+    /**
+       \brief restrict the assignment of the engine to the constants of the asserted formulas.
+    */
+    model_ref local_search::mk_model(model& sls_mdl) {
+        model_ref mdl = alloc(model, m);
+        for (func_decl* d : m_decls)
+            if (expr* v = sls_mdl.get_const_interp(d))
+                mdl->register_decl(d, v);
+        return mdl;
+    }
+
+    /**
+       \brief use the assignment as the phase of all Boolean variables it evaluates.
+       This includes the bits of bit-vector terms.
+    */
+    void local_search::set_phases(model& mdl) {
+        model_evaluator ev(mdl);
+        for (bool_var v = 0; v < static_cast<bool_var>(ctx.get_num_bool_vars()); ++v) {
+            expr* e = ctx.bool_var2expr(v);
+            if (!e)
+                continue;
+            if (ev.is_true(e))
+                ctx.force_phase(v, true);
+            else if (ev.is_false(e))
+                ctx.force_phase(v, false);
+            else
+                continue;
+            ++m_stats.m_num_phases;
+        }
+    }
+
+    lbool local_search::operator()() {
+        m_model = nullptr;
+        if (!init())
+            return l_undef;
+        ++m_stats.m_num_calls;
+        IF_VERBOSE(2, verbose_stream() << "(smt.local-search :formulas " << m_formulas.size() << ")\n");
+
+        params_ref p;
+        // each invocation gets a bounded budget and a different seed.
+        // restart intervals of sls_engine grow exponentially, so the budget is kept small.
+        p.set_uint("max_restarts", 4);
+        p.set_uint("random_seed", ctx.get_fparams().m_random_seed + m_stats.m_num_calls);
+        sls_engine engine(m, p);
+        for (expr* f : m_nnf)
+            engine.assert_expr(f);
+        lbool r = l_undef;
+        try {
+            r = engine();
+        }
+        catch (z3_exception& ex) {
+            IF_VERBOSE(2, verbose_stream() << "(smt.local-search :exception \"" << ex.msg() << "\")\n");
+            return l_undef;
+        }
+        model_ref sls_mdl = engine.get_model();
+        model_ref mdl = mk_model(*sls_mdl);
+        set_phases(*mdl);
+
+        TRACE("local_search", tout << "result: " << r << "\n" << *mdl << "\n";);
+        if (r != l_true)
+            return l_undef;
+        model::scoped_model_completion _scm(*mdl, true);
+        for (expr* f : m_formulas) {
+            if (!mdl->is_true(f)) {
+                IF_VERBOSE(2, verbose_stream() << "(smt.local-search :invalid-model " << mk_bounded_pp(f, m, 3) << ")\n");
+                return l_undef;
+            }
+        }
+        if (!ctx.m_assumptions.empty() || !ctx.m_tmp_clauses.empty())
+            return l_undef;
+        ++m_stats.m_num_models;
+        m_model = mdl;
+        return l_true;
+    }
+
+    void local_search::collect_statistics(::statistics& st) const {
+        st.update("local search calls", m_stats.m_num_calls);
+        st.update("local search models", m_stats.m_num_models);
+        st.update("local search phases", m_stats.m_num_phases);
+    }
+}
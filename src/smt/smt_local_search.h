@@ -0,0 +1,69 @@
+/*++
+Copyright (c) 2006 Microsoft Corporation
+
+Module Name:
+
+    smt_local_search.h
+
+Abstract:
+
+    Bit-vector local search invoked from the SMT search loop.
+
+    The asserted formulas are put in negation normal form and handed
+    to sls_engine when they belong to the quantifier-free bit-vector
+    fragment supported by the engine. The final assignment of the
+    engine is copied into the phase cache of the context. When the
+    assignment satisfies all asserted formulas it is kept as a model.
+
+Revision History:
+
+--*/
+
+#pragma once
+
+#include "ast/ast.h"
+#include "ast/bv_decl_plugin.h"
+#include "model/model.h"
+#include "util/statistics.h"
+
+namespace smt {
+    class context;
+
+    class local_search {
+        struct stats {
+            unsigned m_num_calls;
+            unsigned m_num_models;
+            unsigned m_num_phases;
+            void reset() { memset(this, 0, sizeof(*this)); }
+            stats() { reset(); }
+        };
+
+        context&             ctx;
+        ast_manager&         m;
+        bv_util              m_bv;
+        stats                m_stats;
+        expr_ref_vector      m_formulas;  // asserted formulas
+        expr_ref_vector      m_nnf;       // negation normal form of m_formulas
+        func_decl_ref_vector m_decls;     // constants of m_formulas
+        model_ref            m_model;
+
+        bool is_supported(expr* e) const;
+        bool init();
+        model_ref mk_model(model& sls_mdl);
+        void set_phases(model& mdl);
+
+    public:
+        local_search(context& ctx);
+
+        /**
+           \brief run local search on the current asserted formulas.
+           Return l_true if it found a model of the formulas that
+           can be returned as the result of the current check.
+        */
+        lbool operator()();
+
+        model_ref const& get_model() const { return m_model; }
+
+        void collect_statistics(::statistics& st) const;
+    };
+}
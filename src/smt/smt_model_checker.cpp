@@ -157,19 +157,14 @@ namespace smt {
     }
 
     /**
-       \brief Assert the negation of q after applying the interpretation in m_curr_model to the uninterpreted symbols in q.
+       \brief Assert the negation of q where body is the result of applying the interpretation in m_curr_model 
+       to the uninterpreted symbols in q.
 
        The variables are replaced by skolem constants. These constants are stored in sks.
     */
 
-    bool model_checker::assert_neg_q_m(quantifier * q, expr_ref_vector & sks) {
-        expr_ref tmp(m);
-        
-        TRACE("model_checker", tout << "curr_model:\n"; model_pp(tout, *m_curr_model););
-
-        if (!m_curr_model->eval(q->get_expr(), tmp, true)) {
-            return false;
-        }
+    bool model_checker::assert_neg_q_m(quantifier * q, expr * body, expr_ref_vector & sks) {
+        expr_ref tmp(body, m);
         TRACE("model_checker", tout << "q after applying interpretation:\n" << mk_ismt2_pp(tmp, m) << "\n";);
         ptr_buffer<expr> subst_args;
         unsigned num_decls = q->get_num_decls();
@@ -338,19 +333,75 @@ namespace smt {
         }
     };
 
+    /**
+       \brief The model checking problem for flat_q is determined by the body of flat_q 
+       after applying m_curr_model and by the universes used to restrict its finite sorts.
+    */
+    void model_checker::mk_satisfied_key(quantifier * flat_q, expr * body, ast_ref_vector & key) {
+        key.push_back(body);
+        for (unsigned i = 0; i < flat_q->get_num_decls(); ++i) {
+            sort * s = flat_q->get_decl_sort(i);
+            if (!m_curr_model->is_finite(s))
+                continue;
+            key.push_back(s);
+            for (expr * e : m_curr_model->get_known_universe(s))
+                key.push_back(e);
+        }
+    }
+
+    bool model_checker::is_satisfied(quantifier * q, ast_ref_vector const & key) const {
+        unsigned idx;
+        if (!m_q2satisfied.find(q, idx))
+            return false;
+        ast_ref_vector const & k = m_satisfied_keys[idx];
+        if (k.size() != key.size() + 1)
+            return false;
+        for (unsigned i = 0; i < key.size(); ++i)
+            if (k.get(i + 1) != key.get(i))
+                return false;
+        return true;
+    }
+
+    void model_checker::set_satisfied(quantifier * q, ast_ref_vector const & key) {
+        unsigned idx;
+        if (!m_q2satisfied.find(q, idx)) {
+            idx = m_satisfied_keys.size();
+            m_satisfied_keys.push_back(ast_ref_vector(m));
+            m_q2satisfied.insert(q, idx);
+        }
+        ast_ref_vector & k = m_satisfied_keys[idx];
+        k.reset();
+        k.push_back(q);
+        k.append(key);
+    }
+
     /**
        \brief Return true if q is satisfied by m_curr_model.
     */
 
     bool model_checker::check(quantifier * q) {
         SASSERT(!m_aux_context->relevancy());
-        scoped_ctx_push _push(m_aux_context.get());
+        TRACE("model_checker", tout << "curr_model:\n"; model_pp(tout, *m_curr_model););
 
         quantifier * flat_q = get_flat_quantifier(q);
         TRACE("model_checker", tout << "model checking:\n" << expr_ref(flat_q->get_expr(), m) << "\n";);
+        expr_ref body(m);
+        if (!m_curr_model->eval(flat_q->get_expr(), body, true))
+            return false;
+
+        m_stats.m_num_checks++;
+        ast_ref_vector key(m);
+        mk_satisfied_key(flat_q, body, key);
+        if (is_satisfied(q, key)) {
+            TRACE("model_checker", tout << "quantifier is satisfied by a previous check\n";);
+            m_stats.m_num_cached_checks++;
+            return true;
+        }
+
+        scoped_ctx_push _push(m_aux_context.get());
         expr_ref_vector sks(m);
 
-        if (!assert_neg_q_m(flat_q, sks))
+        if (!assert_neg_q_m(flat_q, body, sks))
             return false;
         TRACE("model_checker", tout << "skolems:\n" << sks << "\n";);
 
@@ -358,6 +409,8 @@ namespace smt {
         lbool r = m_aux_context->check();
         
         TRACE("model_checker", tout << "[complete] model-checker result: " << to_sat_str(r) << "\n";);
+        if (r == l_false) 
+            set_satisfied(q, key);
         if (r != l_true) {
             return r == l_false; // quantifier is satisfied by m_curr_model
         }
@@ -522,6 +575,28 @@ namespace smt {
     void model_checker::init_search_eh() {
         m_max_cexs = m_params.m_mbqi_max_cexs;
         m_iteration_idx = 0;
+        prune_satisfied();
+    }
+
+    /**
+       \brief Forget cached checks of quantifiers that were removed by a pop.
+       The cache holds references to them, so they would otherwise stay alive.
+    */
+    void model_checker::prune_satisfied() {
+        unsigned j = 0;
+        for (unsigned i = 0; i < m_satisfied_keys.size(); ++i) {
+            quantifier * q = to_quantifier(m_satisfied_keys[i].get(0));
+            if (!m_model_finder.is_registered(q)) {
+                m_q2satisfied.erase(q);
+                continue;
+            }
+            if (i != j) {
+                m_satisfied_keys[j].swap(m_satisfied_keys[i]);
+                m_q2satisfied.insert(q, j);
+            }
+            ++j;
+        }
+        m_satisfied_keys.shrink(j);
     }
 
     void model_checker::restart_eh() {
@@ -544,6 +619,11 @@ namespace smt {
         reset_new_instances();
     }
 
+    void model_checker::collect_statistics(::statistics & st) const {
+        st.update("mbqi checks", m_stats.m_num_checks);
+        st.update("mbqi cached checks", m_stats.m_num_cached_checks);
+    }
+
     void model_checker::assert_new_instances() {
         TRACE("model_checker_bug_detail", tout << "assert_new_instances, inconsistent: " << m_context->inconsistent() << "\n";);
         ptr_buffer<enode> bindings;
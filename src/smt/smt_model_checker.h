@@ -21,6 +21,7 @@ Revision History:
 #pragma once
 
 #include "util/obj_hashtable.h"
+#include "util/statistics.h"
 #include "ast/ast.h"
 #include "ast/array_decl_plugin.h"
 #include "ast/normal_forms/defined_names.h"
@@ -37,6 +38,12 @@ namespace smt {
     class quantifier_manager;
 
     class model_checker {
+        struct stats {
+            unsigned m_num_checks, m_num_cached_checks;
+            void reset() { memset(this, 0, sizeof(stats)); }
+            stats() { reset(); }
+        };
+
         ast_manager &                               m; // _manager;
         qi_params const &                           m_params;
         array_util                                  m_autil;
@@ -53,6 +60,18 @@ namespace smt {
         proto_model *                               m_curr_model;
         obj_map<expr, expr *>                       m_value2expr;
         expr_ref_vector                             m_fresh_exprs;
+        stats                                       m_stats;
+
+        // Quantifiers known to be satisfied, keyed by the body of the flat quantifier
+        // after applying the model, and the universes of its finite sorts.
+        // The same key yields the same model checking problem, so the check is skipped.
+        obj_map<quantifier, unsigned>               m_q2satisfied;
+        vector<ast_ref_vector>                      m_satisfied_keys;
+
+        void mk_satisfied_key(quantifier * flat_q, expr * body, ast_ref_vector & key);
+        bool is_satisfied(quantifier * q, ast_ref_vector const & key) const;
+        void set_satisfied(quantifier * q, ast_ref_vector const & key);
+        void prune_satisfied();
 
         friend class model_instantiation_set;
 
@@ -62,7 +81,7 @@ namespace smt {
         expr * get_type_compatible_term(expr * val);
         expr_ref replace_value_from_ctx(expr * e);
         void restrict_to_universe(expr * sk, obj_hashtable<expr> const & universe);
-        bool assert_neg_q_m(quantifier * q, expr_ref_vector & sks);
+        bool assert_neg_q_m(quantifier * q, expr * body, expr_ref_vector & sks);
         bool add_blocking_clause(model * cex, expr_ref_vector & sks);
         bool check(quantifier * q);
         void check_quantifiers(bool& found_relevant, unsigned& num_failures);
@@ -102,6 +121,8 @@ namespace smt {
 
         void reset();
 
+        void collect_statistics(::statistics & st) const;
+
         void operator()(expr* e);
 
     };
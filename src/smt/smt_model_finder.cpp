@@ -2406,6 +2406,12 @@ namespace smt {
     }
 
 
+    /**
+       \brief The auf_solver is rebuilt on every call: instantiation sets are populated
+       from the enodes that are relevant in the current assignment, and fix_model
+       extends the fresh proto model in place. Neither carries over to the next final check.
+       Repeated checks are instead short-circuited by the model checker.
+    */
     void model_finder::process_auf(ptr_vector<quantifier> const& qs, proto_model* mdl) {
         m_auf_solver->reset();
         m_auf_solver->set_model(mdl);
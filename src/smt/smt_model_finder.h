@@ -106,6 +106,7 @@ namespace smt {
         void set_context(context * ctx);
         
         void register_quantifier(quantifier * q);
+        bool is_registered(quantifier * q) const { return m_q2info.contains(q); }
         void push_scope();
         void pop_scope(unsigned num_scopes);
         void reset();
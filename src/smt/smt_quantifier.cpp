@@ -564,6 +564,7 @@ namespace smt {
 
     void quantifier_manager::collect_statistics(::statistics & st) const {
         m_imp->m_qi_queue.collect_statistics(st);
+        m_imp->m_plugin->collect_statistics(st);
     }
 
     void quantifier_manager::reset_statistics() {
@@ -736,6 +737,11 @@ namespace smt {
             return m_active && (m_mam->is_shared(n) || m_lazy_mam->is_shared(n));
         }
 
+        void collect_statistics(::statistics & st) const override {
+            if (m_model_checker)
+                m_model_checker->collect_statistics(st);
+        }
+
         void adjust_model(proto_model * m) override {
             if (m_fparams->m_mbqi) {
                 m_model_finder->fix_model(m);
@@ -121,13 +121,34 @@ namespace smt {
         }
     }
 
+    /**
+       \brief Instantiate the upward read-over-write axioms of v.
+
+       Parent stores and selects are only ever appended (and removed on backtracking),
+       so pairs below the recorded prefixes were already handled at the current scope
+       and only the new pairs are visited. This keeps repeated final checks linear
+       in the number of new parents instead of re-scanning the whole product.
+    */
     bool theory_array::instantiate_axiom2b_for(theory_var v) {
         bool result = false;
         var_data * d = m_var_data[v];
-        for (enode* n1 : d->m_parent_stores) 
-            for (enode * n2 : d->m_parent_selects) 
-                if (instantiate_axiom2b(n2, n1))
+        unsigned num_stores  = d->m_parent_stores.size();
+        unsigned num_selects = d->m_parent_selects.size();
+        unsigned old_stores  = d->m_axiom2b_stores;
+        unsigned old_selects = d->m_axiom2b_selects;
+        SASSERT(old_stores <= num_stores && old_selects <= num_selects);
+        if (old_stores == num_stores && old_selects == num_selects)
+            return false;
+        for (unsigned i = 0; i < num_stores; ++i) {
+            enode * n1 = d->m_parent_stores[i];
+            for (unsigned j = i < old_stores ? old_selects : 0; j < num_selects; ++j) 
+                if (instantiate_axiom2b(d->m_parent_selects[j], n1))
                     result = true;
+        }
+        m_trail_stack.push(value_trail<unsigned>(d->m_axiom2b_stores));
+        m_trail_stack.push(value_trail<unsigned>(d->m_axiom2b_selects));
+        d->m_axiom2b_stores  = num_stores;
+        d->m_axiom2b_selects = num_selects;
         return result;
     }
 
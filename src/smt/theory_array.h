@@ -44,7 +44,10 @@ namespace smt {
             bool               m_prop_upward;
             bool               m_is_array;
             bool               m_is_select;
-            var_data():m_prop_upward(false), m_is_array(false), m_is_select(false) {}
+            // prefixes of m_parent_stores x m_parent_selects already passed to instantiate_axiom2b
+            unsigned           m_axiom2b_stores;
+            unsigned           m_axiom2b_selects;
+            var_data():m_prop_upward(false), m_is_array(false), m_is_select(false), m_axiom2b_stores(0), m_axiom2b_selects(0) {}
         };
         ptr_vector<var_data>            m_var_data;
         theory_array_params&            m_params;
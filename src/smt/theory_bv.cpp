@@ -33,6 +33,8 @@ namespace smt {
         m_bits.push_back(literal_vector());
         m_wpos.push_back(0);
         m_zero_one_bits.push_back(zero_one_bits());
+        m_bound_atoms.push_back(bool_var_vector());
+        m_lazy_conflicts.push_back(0);
         ctx.attach_th_var(n, this, r);
         return r;
     }
@@ -222,6 +224,16 @@ namespace smt {
         }
     };
 
+    class add_bound_atom_trail : public trail {
+        theory_bv & th;
+        theory_var  m_var;
+    public:
+        add_bound_atom_trail(theory_bv & th, theory_var v):th(th), m_var(v) {}
+        void undo() override {
+            th.m_bound_atoms[m_var].pop_back();
+        }
+    };
+
     void theory_bv::add_new_diseq_axiom(theory_var v1, theory_var v2, unsigned idx) {
         m_prop_diseqs.push_back(bv_diseq(v1, v2, idx));
         ctx.push_trail(push_back_vector<svector<bv_diseq>>(m_prop_diseqs));
@@ -895,11 +907,11 @@ namespace smt {
         case OP_BV_NUM:         internalize_num(term); return true;
         case OP_BADD:           internalize_add(term); return true;
         case OP_BSUB:           internalize_sub(term); return true;
-        case OP_BMUL:           internalize_mul(term); return true;
+        case OP_BMUL:           if (!internalize_lazy(term)) internalize_mul(term); return true;
         case OP_BSDIV_I:        internalize_sdiv(term); return true;
-        case OP_BUDIV_I:        internalize_udiv(term); return true;
+        case OP_BUDIV_I:        if (!internalize_lazy(term)) internalize_udiv(term); return true;
         case OP_BSREM_I:        internalize_srem(term); return true;
-        case OP_BUREM_I:        internalize_urem(term); return true;
+        case OP_BUREM_I:        if (!internalize_lazy(term)) internalize_urem(term); return true;
         case OP_BSMOD_I:        internalize_smod(term); return true;
         case OP_BAND:           internalize_and(term); return true;
         case OP_BOR:            internalize_or(term); return true;
@@ -1012,6 +1024,13 @@ namespace smt {
         le_atom * a     = new (get_region()) le_atom(l, def);
         insert_bv2a(l.var(), a);
         m_trail_stack.push(mk_atom_trail(*this, l.var()));
+        theory_var v;
+        numeral c;
+        bool is_upper;
+        if (!Signed && params().m_bv_lazy_blast && is_bound_atom(n, v, c, is_upper)) {
+            m_bound_atoms[v].push_back(l.var());
+            m_trail_stack.push(add_bound_atom_trail(*this, v));
+        }
         if (!ctx.relevancy() || !params().m_bv_lazy_le) {
             ctx.mk_th_axiom(get_id(),  l, ~def);
             ctx.mk_th_axiom(get_id(), ~l,  def);
@@ -1127,6 +1146,474 @@ namespace smt {
         return false;
     }
 
+    //
+    // With bv.lazy_blast, multipliers and unsigned dividers are internalized
+    // with fresh bits, as if they were uninterpreted. Their semantics is only
+    // enforced by bit-blasting in final_check_eh when the assignment violates it,
+    // or once word-level propagation on the operator has caused
+    // LAZY_BLAST_CONFLICTS conflicts, since each of these conflicts only rules
+    // out few values of the arguments.
+    //
+#define LAZY_BLAST_CONFLICTS 16
+
+    bool theory_bv::internalize_lazy(app * n) {
+        if (!params().m_bv_lazy_blast)
+            return false;
+        SASSERT(!ctx.e_internalized(n));
+        process_args(n);
+        enode * e    = mk_enode(n);
+        theory_var v = e->get_th_var(get_id());
+        mk_bits(v);
+        for (unsigned i = 0; i < n->get_num_args(); ++i)
+            get_arg_var(e, i);
+        m_lazy_ops.push_back(n);
+        m_trail_stack.push(push_back_vector<ptr_vector<app>>(m_lazy_ops));
+        m_word_prop_queue.push_back(n);
+        m_stats.m_num_lazy_ops++;
+        TRACE("bv", tout << "lazy: " << mk_bounded_pp(n, m) << "\n";);
+        return true;
+    }
+
+    bool theory_bv::lazy_op_holds(app * n) {
+        numeral val, arg1, arg2;
+        if (!get_fixed_value(n, val))
+            return false;
+        numeral bound = rational::power_of_two(get_bv_size(n));
+        switch (n->get_decl_kind()) {
+        case OP_BMUL:
+            arg1 = numeral::one();
+            for (expr * arg : *n) {
+                if (!get_fixed_value(to_app(arg), arg2))
+                    return false;
+                arg1 = mod(arg1 * arg2, bound);
+            }
+            return arg1 == val;
+        case OP_BUDIV_I:
+        case OP_BUREM_I:
+            if (!get_fixed_value(to_app(n->get_arg(0)), arg1) ||
+                !get_fixed_value(to_app(n->get_arg(1)), arg2))
+                return false;
+            // division by zero is left to the bit-blaster.
+            if (arg2.is_zero())
+                return false;
+            if (n->get_decl_kind() == OP_BUDIV_I)
+                return div(arg1, arg2) == val;
+            return mod(arg1, arg2) == val;
+        default:
+            UNREACHABLE();
+            return true;
+        }
+    }
+
+    void theory_bv::blast_lazy_op(app * n) {
+        enode * e    = ctx.get_enode(n);
+        theory_var v = e->get_th_var(get_id());
+        expr_ref_vector arg1_bits(m), arg2_bits(m), bits(m);
+        switch (n->get_decl_kind()) {
+        case OP_BMUL: {
+            unsigned i = n->get_num_args() - 1;
+            get_arg_bits(e, i, bits);
+            while (i > 0) {
+                --i;
+                arg1_bits.reset();
+                arg2_bits.reset();
+                get_arg_bits(e, i, arg1_bits);
+                m_bb.mk_multiplier(arg1_bits.size(), arg1_bits.data(), bits.data(), arg2_bits);
+                bits.swap(arg2_bits);
+            }
+            break;
+        }
+        case OP_BUDIV_I:
+        case OP_BUREM_I:
+            get_arg_bits(e, 0, arg1_bits);
+            get_arg_bits(e, 1, arg2_bits);
+            if (n->get_decl_kind() == OP_BUDIV_I)
+                m_bb.mk_udiv(arg1_bits.size(), arg1_bits.data(), arg2_bits.data(), bits);
+            else
+                m_bb.mk_urem(arg1_bits.size(), arg1_bits.data(), arg2_bits.data(), bits);
+            break;
+        default:
+            UNREACHABLE();
+            return;
+        }
+        SASSERT(bits.size() == m_bits[v].size());
+        ctx.internalize(bits.data(), bits.size(), true);
+        for (unsigned i = 0; i < bits.size(); ++i) {
+            literal a = m_bits[v][i];
+            literal b = ctx.get_literal(bits.get(i));
+            ctx.mark_as_relevant(b);
+            ctx.mk_th_axiom(get_id(), ~a, b);
+            ctx.mk_th_axiom(get_id(), a, ~b);
+        }
+        m_lazy_blasted.insert(n);
+        m_trail_stack.push(insert_obj_trail<app>(m_lazy_blasted, n));
+        if (!ctx.at_base_level() && e->get_iscope_lvl() <= ctx.get_base_level())
+            m_lazy_restart.push_back(n);
+        m_stats.m_num_lazy_blasted++;
+        TRACE("bv", tout << "blast: " << mk_bounded_pp(n, m) << "\n";);
+    }
+
+    /**
+       \brief The circuits of lazy operators are removed when the scope they were
+       added in is popped. Add them again at the base level for operators that
+       exist there.
+    */
+    void theory_bv::restart_eh() {
+        app_ref_vector tmp(m_lazy_restart);
+        m_lazy_restart.reset();
+        for (app * n : tmp) {
+            if (ctx.inconsistent())
+                break;
+            if (is_lazy_op(n))
+                blast_lazy_op(n);
+        }
+    }
+
+    /**
+       \brief Bit-blast the relevant lazy operators whose current values do not
+       agree with their semantics. Return true if some operator was bit-blasted.
+    */
+    bool theory_bv::check_lazy_ops() {
+        bool blasted = false;
+        for (unsigned i = 0; i < m_lazy_ops.size() && !ctx.inconsistent(); ++i) {
+            app * n = m_lazy_ops[i];
+            if (m_lazy_blasted.contains(n) || !ctx.is_relevant(n) || lazy_op_holds(n))
+                continue;
+            blast_lazy_op(n);
+            blasted = true;
+        }
+        return blasted;
+    }
+
+    bool theory_bv::is_lazy_op(app * n) const {
+        if (!params().m_bv_lazy_blast || n->get_family_id() != get_id())
+            return false;
+        switch (n->get_decl_kind()) {
+        case OP_BMUL:
+        case OP_BUDIV_I:
+        case OP_BUREM_I:
+            return ctx.e_internalized(n) && !m_lazy_blasted.contains(n);
+        default:
+            return false;
+        }
+    }
+
+    /**
+       \brief Return true if e is an unsigned comparison between a bit-vector variable v
+       and a numeral c. is_upper is true if e is (bvule v c) and false if e is (bvule c v).
+    */
+    bool theory_bv::is_bound_atom(expr * e, theory_var & v, numeral & c, bool & is_upper) const {
+        expr * s = nullptr, * t = nullptr;
+        unsigned sz;
+        if (!m_util.is_bv_ule(e, s, t))
+            return false;
+        if (m_util.is_numeral(t, c, sz) && !m_util.is_numeral(s))
+            is_upper = true;
+        else if (m_util.is_numeral(s, c, sz) && !m_util.is_numeral(t))
+            is_upper = false;
+        else
+            return false;
+        expr * x = is_upper ? s : t;
+        if (!ctx.e_internalized(x))
+            return false;
+        v = ctx.get_enode(x)->get_th_var(get_id());
+        return v != null_theory_var;
+    }
+
+    /**
+       \brief Compute the unsigned interval [lo, hi] of v implied by its assigned bits
+       and by the assigned bound atoms on v. The literals that imply lo are added to
+       lo_lits, and the literals that imply hi to hi_lits: the bits assigned to true
+       or the strongest lower bound atom, and the bits assigned to false or the
+       strongest upper bound atom.
+    */
+    void theory_bv::get_bit_bounds(theory_var v, numeral & lo, numeral & hi, literal_vector & lo_lits, literal_vector & hi_lits) const {
+        lo.reset();
+        hi.reset();
+        unsigned lo_sz = lo_lits.size(), hi_sz = hi_lits.size();
+        unsigned i = 0;
+        for (literal b : m_bits[v]) {
+            for (unsigned j = m_power2.size(); j <= i; ++j) 
+                m_power2.push_back(m_bb.power(j));
+            switch (ctx.get_assignment(b)) {
+            case l_true:
+                lo += m_power2[i];
+                hi += m_power2[i];
+                if (b != true_literal)
+                    lo_lits.push_back(b);
+                break;
+            case l_false:
+                if (b != false_literal)
+                    hi_lits.push_back(~b);
+                break;
+            case l_undef:
+                hi += m_power2[i];
+                break;
+            }
+            ++i;
+        }
+        theory_var w;
+        numeral c;
+        bool is_upper;
+        for (bool_var b : m_bound_atoms[v]) {
+            lbool val = ctx.get_assignment(b);
+            if (val == l_undef)
+                continue;
+            VERIFY(is_bound_atom(ctx.bool_var2expr(b), w, c, is_upper));
+            literal lit(b, val == l_false);
+            // not (v <= c) is c + 1 <= v, and not (c <= v) is v <= c - 1
+            if (val == l_false)
+                c += is_upper ? numeral::one() : numeral::minus_one();
+            if (is_upper == (val == l_true) && c < hi) {
+                hi = c;
+                hi_lits.shrink(hi_sz);
+                hi_lits.push_back(lit);
+            }
+            else if (is_upper != (val == l_true) && c > lo) {
+                lo = c;
+                lo_lits.shrink(lo_sz);
+                lo_lits.push_back(lit);
+            }
+        }
+    }
+
+    /**
+       \brief Compute the interval of v into lo, hi. Return false and set a conflict
+       if the assigned bits and bounds of v have no common value.
+    */
+    bool theory_bv::get_word_bounds(theory_var v, numeral & lo, numeral & hi, literal_vector & lo_lits, literal_vector & hi_lits) {
+        get_bit_bounds(v, lo, hi, lo_lits, hi_lits);
+        if (lo <= hi)
+            return true;
+        set_word_conflict(lo_lits, hi_lits);
+        return false;
+    }
+
+    void theory_bv::set_word_conflict(literal_vector const & lo_lits, literal_vector const & hi_lits) {
+        literal_vector lits(lo_lits);
+        lits.append(hi_lits);
+        TRACE("bv", tout << "word conflict: " << lits << "\n";);
+        m_stats.m_num_conflicts++;
+        ctx.set_conflict(ctx.mk_justification(
+                             ext_theory_conflict_justification(get_id(), ctx, lits.size(), lits.data(), 0, nullptr)));
+    }
+
+    bool theory_bv::is_word_op(app * n) const {
+        if (is_lazy_op(n))
+            return true;
+        return params().m_bv_lazy_blast && m_util.is_bv_add(n) && ctx.e_internalized(n);
+    }
+
+    /**
+       \brief A bit or a bound of v was assigned. Queue the word-level operators
+       that use v as an argument or define v.
+    */
+    void theory_bv::push_word_prop(theory_var v) {
+        enode * n = get_enode(v);
+        if (is_word_op(n->get_expr()))
+            m_word_prop_queue.push_back(n->get_expr());
+        for (enode * p : n->get_parents()) {
+            if (is_word_op(p->get_expr()))
+                m_word_prop_queue.push_back(p->get_expr());
+        }
+    }
+
+    /**
+       \brief Fix the bits shared by all values of v in [lo, hi]. lo_lits imply that v
+       is at least lo, and hi_lits that v is at most hi. Leading bits that are zero in
+       the common prefix only depend on hi, and leading bits that are one only on lo.
+    */
+    void theory_bv::fix_word_bits(theory_var v, numeral const & lo, numeral const & hi, literal_vector const & lo_lits, literal_vector const & hi_lits) {
+        if (lo > hi) {
+            set_word_conflict(lo_lits, hi_lits);
+            return;
+        }
+        literal_vector const & bits = m_bits[v];
+        bool zeros = true, ones = true;
+        literal_vector both;
+        for (unsigned i = bits.size(); i-- > 0 && !ctx.inconsistent(); ) {
+            bool is_true = lo.get_bit(i);
+            if (is_true != hi.get_bit(i))
+                break;
+            zeros &= !is_true;
+            ones  &= is_true;
+            literal lit = is_true ? bits[i] : ~bits[i];
+            lbool val = ctx.get_assignment(lit);
+            if (val == l_true)
+                continue;
+            if (!zeros && !ones && both.empty()) {
+                both.append(lo_lits);
+                both.append(hi_lits);
+            }
+            literal_vector const & lits = zeros ? hi_lits : ones ? lo_lits : both;
+            TRACE("bv", tout << "word propagation: v" << v << " [" << lo << ", " << hi << "] bit " << i << "\n";);
+            if (lit == false_literal) {
+                set_word_conflict(lits, literal_vector());
+                return;
+            }
+            m_stats.m_num_word_props++;
+            ctx.assign(lit, ctx.mk_justification(
+                           ext_theory_propagation_justification(get_id(), ctx, lits.size(), lits.data(), 0, nullptr, lit)));
+        }
+    }
+
+    /**
+       \brief An assigned bound atom on v may fix the leading bits of v. These bits
+       then reach the terms built from v by extraction, concatenation or shifts
+       through their circuits.
+    */
+    void theory_bv::propagate_word_bounds(theory_var v) {
+        numeral lo, hi;
+        literal_vector lo_lits, hi_lits;
+        if (get_word_bounds(v, lo, hi, lo_lits, hi_lits))
+            fix_word_bits(v, lo, hi, lo_lits, hi_lits);
+    }
+
+    /**
+       \brief Word-level propagation for an operator queued by push_word_prop.
+       Lazy operators that caused too many conflicts are bit-blasted instead.
+    */
+    void theory_bv::propagate_word(app * n) {
+        if (!is_word_op(n))
+            return;
+        enode * e    = ctx.get_enode(n);
+        theory_var v = e->get_th_var(get_id());
+        if (!is_lazy_op(n)) {
+            propagate_word(n, e, v);
+            return;
+        }
+        if (m_lazy_conflicts[v] >= LAZY_BLAST_CONFLICTS) {
+            m_lazy_pending.push_back(n);
+            return;
+        }
+        propagate_word(n, e, v);
+        if (ctx.inconsistent() && ++m_lazy_conflicts[v] >= LAZY_BLAST_CONFLICTS)
+            m_lazy_pending.push_back(n);
+    }
+
+    /**
+       \brief Fix the bits of x from the interval [lo, hi] derived for it, keeping
+       its current bounds lo_x (implied by lo_x_lits) and hi_x where they are tighter.
+    */
+    void theory_bv::tighten_word_bits(theory_var x, numeral const & lo_x, numeral const & hi_x, literal_vector const & lo_x_lits, literal_vector const & hi_x_lits,
+                                      numeral const & lo, numeral const & hi, literal_vector const & lo_lits, literal_vector const & hi_lits) {
+        bool new_lo = lo > lo_x, new_hi = hi < hi_x;
+        if (!new_lo && !new_hi)
+            return;
+        fix_word_bits(x, new_lo ? lo : lo_x, new_hi ? hi : hi_x, new_lo ? lo_lits : lo_x_lits, new_hi ? hi_lits : hi_x_lits);
+    }
+
+    /**
+       \brief The intervals of the arguments bound the result, and as long as the
+       operation does not wrap around, the interval of the result bounds the
+       arguments. The bits shared by all values in a derived interval are fixed.
+       Each bound is justified by the literals of the bounds it is computed from.
+    */
+    void theory_bv::propagate_word(app * n, enode * e, theory_var v) {
+        unsigned sz  = get_bv_size(n);
+        numeral bound = rational::power_of_two(sz);
+        numeral lo, hi, lo1, hi1, lo2, hi2, lo_r, hi_r;
+        literal_vector lo1_lits, hi1_lits, lo2_lits, hi2_lits, lo_r_lits, hi_r_lits, lo_lits, hi_lits;
+        auto join = [](std::initializer_list<literal_vector const *> vs) {
+            literal_vector r;
+            for (literal_vector const * lits : vs)
+                r.append(*lits);
+            return r;
+        };
+        if (n->get_num_args() != 2) {
+            bool is_mul = m_util.is_bv_mul(n);
+            SASSERT(is_mul || m_util.is_bv_add(n));
+            lo = is_mul ? numeral::one() : numeral::zero();
+            hi = lo;
+            for (unsigned i = 0; i < n->get_num_args(); ++i) {
+                if (!get_word_bounds(get_arg_var(e, i), lo1, hi1, lo_lits, hi_lits))
+                    return;
+                lo = is_mul ? lo * lo1 : lo + lo1;
+                hi = is_mul ? hi * hi1 : hi + hi1;
+                if (hi >= bound)
+                    return;
+            }
+            // the lower bound also needs the upper bounds that rule out wrap-around
+            fix_word_bits(v, lo, hi, join({ &lo_lits, &hi_lits }), hi_lits);
+            return;
+        }
+        theory_var v1 = get_arg_var(e, 0), v2 = get_arg_var(e, 1);
+        if (!get_word_bounds(v1, lo1, hi1, lo1_lits, hi1_lits) || !get_word_bounds(v2, lo2, hi2, lo2_lits, hi2_lits))
+            return;
+        switch (n->get_decl_kind()) {
+        case OP_BADD:
+        case OP_BMUL: {
+            bool is_add = n->get_decl_kind() == OP_BADD;
+            hi = is_add ? hi1 + hi2 : hi1 * hi2;
+            if (hi >= bound)
+                return;
+            lo = is_add ? lo1 + lo2 : lo1 * lo2;
+            hi_lits = join({ &hi1_lits, &hi2_lits });
+            fix_word_bits(v, lo, hi, join({ &lo1_lits, &lo2_lits, &hi_lits }), hi_lits);
+            if (ctx.inconsistent() || !get_word_bounds(v, lo_r, hi_r, lo_r_lits, hi_r_lits))
+                return;
+            // v = v1 op v2 without wrap-around, so v1 is in [lo_r - hi2, hi_r - lo2]
+            // or in [lo_r / hi2, hi_r / lo2], and symmetrically for v2.
+            lo_lits = join({ &lo_r_lits, &hi_lits });
+            if (is_add) {
+                tighten_word_bits(v1, lo1, hi1, lo1_lits, hi1_lits, lo_r - hi2, hi_r - lo2, lo_lits, join({ &hi_r_lits, &lo2_lits, &hi_lits }));
+                if (!ctx.inconsistent())
+                    tighten_word_bits(v2, lo2, hi2, lo2_lits, hi2_lits, lo_r - hi1, hi_r - lo1, lo_lits, join({ &hi_r_lits, &lo1_lits, &hi_lits }));
+            }
+            else {
+                if (!hi2.is_zero())
+                    tighten_word_bits(v1, lo1, hi1, lo1_lits, hi1_lits, ceil(lo_r / hi2), lo2.is_zero() ? hi1 : floor(hi_r / lo2), lo_lits, join({ &hi_r_lits, &lo2_lits, &hi_lits }));
+                if (!ctx.inconsistent() && !hi1.is_zero())
+                    tighten_word_bits(v2, lo2, hi2, lo2_lits, hi2_lits, ceil(lo_r / hi1), lo1.is_zero() ? hi2 : floor(hi_r / lo1), lo_lits, join({ &hi_r_lits, &lo1_lits, &hi_lits }));
+            }
+            break;
+        }
+        case OP_BUDIV_I:
+            if (lo2.is_zero())
+                return;
+            // the divisor is not zero by lo2_lits
+            fix_word_bits(v, div(lo1, hi2), div(hi1, lo2), join({ &lo1_lits, &hi2_lits, &lo2_lits }), join({ &hi1_lits, &lo2_lits }));
+            if (ctx.inconsistent() || !get_word_bounds(v, lo_r, hi_r, lo_r_lits, hi_r_lits))
+                return;
+            // v1 = v * v2 + r with r < v2
+            lo = lo_r * lo2;
+            hi = hi_r * hi2 + hi2 - numeral::one();
+            tighten_word_bits(v1, lo1, hi1, lo1_lits, hi1_lits, lo, hi, join({ &lo_r_lits, &lo2_lits }), join({ &hi_r_lits, &hi2_lits, &lo2_lits }));
+            break;
+        case OP_BUREM_I:
+            if (lo2.is_zero())
+                return;
+            if (hi1 < lo2) {
+                // the dividend is below the divisor, so it is the remainder
+                lo = lo1;
+                hi = hi1;
+                lo_lits = join({ &lo1_lits, &hi1_lits, &lo2_lits });
+                hi_lits = join({ &hi1_lits, &lo2_lits });
+            }
+            else if (hi1 < hi2) {
+                lo = numeral::zero();
+                hi = hi1;
+                hi_lits = hi1_lits;
+            }
+            else {
+                lo = numeral::zero();
+                hi = hi2 - numeral::one();
+                hi_lits = join({ &hi2_lits, &lo2_lits });
+            }
+            fix_word_bits(v, lo, hi, lo_lits, hi_lits);
+            if (ctx.inconsistent() || !get_word_bounds(v, lo_r, hi_r, lo_r_lits, hi_r_lits))
+                return;
+            // the remainder does not exceed the dividend and is below a non-zero divisor
+            tighten_word_bits(v1, lo1, hi1, lo1_lits, hi1_lits, lo_r, hi1, lo_r_lits, hi1_lits);
+            if (!ctx.inconsistent())
+                tighten_word_bits(v2, lo2, hi2, lo2_lits, hi2_lits, lo_r + numeral::one(), hi2, join({ &lo_r_lits, &lo2_lits }), hi2_lits);
+            break;
+        default:
+            UNREACHABLE();
+            return;
+        }
+    }
+
     void theory_bv::apply_sort_cnstr(enode * n, sort * s) {
         if (!is_attached_to_var(n) && !approximate_term(n->get_expr())) {
             mk_bits(mk_var(n));
@@ -1236,6 +1723,8 @@ namespace smt {
             var_pos_occ * curr = b->m_occs;
             while (curr) {
                 m_prop_queue.push_back(var_pos(curr->m_var, curr->m_idx));
+                if (params().m_bv_lazy_blast)
+                    push_word_prop(curr->m_var);
                 curr = curr->m_next;
             }
             propagate_bits();
@@ -1249,6 +1738,15 @@ namespace smt {
                 m_diseq_watch[v].reset();
             }
         }
+        else if (params().m_bv_lazy_blast) {
+            theory_var w;
+            numeral c;
+            bool is_upper;
+            if (is_bound_atom(ctx.bool_var2expr(v), w, c, is_upper)) {
+                m_word_bound_queue.push_back(w);
+                push_word_prop(w);
+            }
+        }
     }
     
     void theory_bv::propagate_bits() {
@@ -1419,6 +1917,10 @@ namespace smt {
         m_bits.shrink(num_old_vars);
         m_wpos.shrink(num_old_vars);
         m_zero_one_bits.shrink(num_old_vars);
+        m_bound_atoms.shrink(num_old_vars);
+        m_lazy_conflicts.shrink(num_old_vars);
+        m_word_prop_queue.reset();
+        m_word_bound_queue.reset();
         unsigned old_trail_sz = m_diseq_watch_lim[m_diseq_watch_lim.size()-num_scopes];
         for (unsigned i = m_diseq_watch_trail.size(); i-- > old_trail_sz;) {
             if (!m_diseq_watch[m_diseq_watch_trail[i]].empty()) {
@@ -1434,6 +1936,9 @@ namespace smt {
 
     final_check_status theory_bv::final_check_eh() {
         SASSERT(check_invariant());
+        if (check_lazy_ops()) {
+            return FC_CONTINUE;
+        }
         if (m_approximates_large_bvs) {
             return FC_GIVEUP;
         }
@@ -1444,6 +1949,10 @@ namespace smt {
         pop_scope_eh(m_trail_stack.get_num_scopes());
         m_bool_var2atom.reset();
         m_fixed_var_table.reset();
+        m_lazy_ops.reset();
+        m_lazy_blasted.reset();
+        m_lazy_pending.reset();
+        m_lazy_restart.reset();
         theory::reset_eh();
     }
 
@@ -1473,7 +1982,9 @@ namespace smt {
         m_bb(ctx.get_manager(), ctx.get_fparams()),
         m_trail_stack(),
         m_find(*this),
-        m_approximates_large_bvs(false) {
+        m_approximates_large_bvs(false),
+        m_lazy_pending(ctx.get_manager()),
+        m_lazy_restart(ctx.get_manager()) {
         memset(m_eq_activity, 0, sizeof(m_eq_activity));
         memset(m_diseq_activity, 0, sizeof(m_diseq_activity));
     }
@@ -1642,6 +2153,18 @@ namespace smt {
             auto p = m_prop_diseqs[m_prop_diseqs_qhead];
             assert_new_diseq_axiom(p.v1, p.v2, p.idx);
         }
+        for (unsigned i = 0; i < m_word_bound_queue.size() && !ctx.inconsistent(); ++i)
+            propagate_word_bounds(m_word_bound_queue[i]);
+        m_word_bound_queue.reset();
+        for (unsigned i = 0; i < m_word_prop_queue.size() && !ctx.inconsistent(); ++i)
+            propagate_word(m_word_prop_queue[i]);
+        m_word_prop_queue.reset();
+        if (ctx.inconsistent())
+            return;
+        for (unsigned i = 0; i < m_lazy_pending.size() && !ctx.inconsistent(); ++i) 
+            if (is_lazy_op(m_lazy_pending.get(i)))
+                blast_lazy_op(m_lazy_pending.get(i));
+        m_lazy_pending.reset();
     }
 
     class bit_eq_justification : public justification {
@@ -1849,6 +2372,9 @@ namespace smt {
         st.update("bv bit2core", m_stats.m_num_bit2core);
         st.update("bv->core eq", m_stats.m_num_th2core_eq);
         st.update("bv dynamic eqs", m_stats.m_num_eq_dynamic);
+        st.update("bv lazy ops", m_stats.m_num_lazy_ops);
+        st.update("bv lazy blasted", m_stats.m_num_lazy_blasted);
+        st.update("bv word propagations", m_stats.m_num_word_props);
     }
 
     theory_bv::var_enode_pos theory_bv::get_bv_with_theory(bool_var v, theory_id id) const {
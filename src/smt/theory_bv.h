@@ -21,6 +21,7 @@ Revision History:
 #include "ast/rewriter/bit_blaster/bit_blaster.h"
 #include "util/trail.h"
 #include "util/union_find.h"
+#include "util/obj_hashtable.h"
 #include "ast/arith_decl_plugin.h"
 #include "model/numeral_factory.h"
 #include "smt/smt_theory.h"
@@ -31,6 +32,7 @@ namespace smt {
     struct theory_bv_stats {
         unsigned   m_num_diseq_static, m_num_diseq_dynamic, m_num_bit2core, m_num_th2core_eq, m_num_conflicts;
         unsigned   m_num_eq_dynamic;
+        unsigned   m_num_lazy_ops, m_num_lazy_blasted, m_num_word_props;
         void reset() { memset(this, 0, sizeof(theory_bv_stats)); }
         theory_bv_stats() { reset(); }
     };
@@ -138,6 +140,14 @@ namespace smt {
         literal_vector           m_tmp_literals;
         svector<var_pos>         m_prop_queue;
         bool                     m_approximates_large_bvs;
+        ptr_vector<app>          m_lazy_ops;     // multipliers and dividers whose bit-blasting is delayed
+        obj_hashtable<app>       m_lazy_blasted; // lazy operators that have been bit-blasted in the current scope
+        ptr_vector<app>          m_word_prop_queue; // word-level operators whose arguments or results had bits or bounds assigned
+        svector<theory_var>      m_word_bound_queue; // variables whose bound atoms were assigned
+        vector<bool_var_vector>  m_bound_atoms;     // unsigned comparisons of a variable with a numeral, used by lazy operators
+        unsigned_vector          m_lazy_conflicts;  // word conflicts raised by the lazy operator defining a variable
+        app_ref_vector           m_lazy_pending;    // lazy operators to bit-blast at the next propagation
+        app_ref_vector           m_lazy_restart;    // lazy operators internalized at the base level and bit-blasted above it
 
         theory_var find(theory_var v) const { return m_find.find(v); }
         theory_var next(theory_var v) const { return m_find.next(v); }
@@ -165,6 +175,7 @@ namespace smt {
         void get_arg_bits(enode * n, unsigned idx, expr_ref_vector & r);
         void get_arg_bits(app * n, unsigned idx, expr_ref_vector & r);
         friend class add_var_pos_trail;
+        friend class add_bound_atom_trail;
         void simplify_bit(expr * s, expr_ref & r);
         void add_new_diseq_axiom(theory_var v1, theory_var v2, unsigned idx);
         void assert_new_diseq_axiom(theory_var v1, theory_var v2, unsigned idx);
@@ -217,6 +228,23 @@ namespace smt {
         void internalize_smul_no_underflow(app *n);
 
         bool approximate_term(app* n);
+        bool internalize_lazy(app * n);
+        bool lazy_op_holds(app * n);
+        void blast_lazy_op(app * n);
+        bool check_lazy_ops();
+        bool is_lazy_op(app * n) const;
+        bool is_bound_atom(expr * e, theory_var & v, numeral & c, bool & is_upper) const;
+        bool is_word_op(app * n) const;
+        void get_bit_bounds(theory_var v, numeral & lo, numeral & hi, literal_vector & lo_lits, literal_vector & hi_lits) const;
+        bool get_word_bounds(theory_var v, numeral & lo, numeral & hi, literal_vector & lo_lits, literal_vector & hi_lits);
+        void set_word_conflict(literal_vector const & lo_lits, literal_vector const & hi_lits);
+        void push_word_prop(theory_var v);
+        void fix_word_bits(theory_var v, numeral const & lo, numeral const & hi, literal_vector const & lo_lits, literal_vector const & hi_lits);
+        void tighten_word_bits(theory_var x, numeral const & lo_x, numeral const & hi_x, literal_vector const & lo_x_lits, literal_vector const & hi_x_lits,
+                               numeral const & lo, numeral const & hi, literal_vector const & lo_lits, literal_vector const & hi_lits);
+        void propagate_word_bounds(theory_var v);
+        void propagate_word(app * n);
+        void propagate_word(app * n, enode * e, theory_var v);
 
         template<bool Signed>
         void internalize_le(app * atom);
@@ -245,8 +273,9 @@ namespace smt {
         bool include_func_interp(func_decl* f) override;
         svector<theory_var>   m_merge_aux[2]; //!< auxiliary vector used in merge_zero_one_bits
         bool merge_zero_one_bits(theory_var r1, theory_var r2);
-        bool can_propagate() override { return m_prop_diseqs_qhead < m_prop_diseqs.size(); }
+        bool can_propagate() override { return m_prop_diseqs_qhead < m_prop_diseqs.size() || !m_word_prop_queue.empty() || !m_word_bound_queue.empty() || !m_lazy_pending.empty(); }
         void propagate() override;
+        void restart_eh() override;
 
         // -----------------------------------
         //
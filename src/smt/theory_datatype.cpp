@@ -67,6 +67,76 @@ namespace smt {
         n = n->get_root();
         n->set_mark2();
         m_to_unmark2.push_back(n); 
+
+        // Remember the class as cycle free across final checks if all its children
+        // are remembered as well. Children reached through arrays or sequences are
+        // not tracked by oc_invalidate, so such classes are only marked for this check.
+        theory_var v = n->get_th_var(get_id());
+        if (v == null_theory_var)
+            return;
+        var_data * d = m_var_data[m_find.find(v)];
+        if (d->m_cycle_free)
+            return;
+        if (d->m_constructor) {
+            for (enode * arg : enode::args(d->m_constructor)) {
+                sort * s = arg->get_sort(), *se = nullptr;
+                if (m_util.is_datatype(s) && !oc_known_cycle_free(arg))
+                    return;
+                if (m_sutil.is_seq(s, se) && m_util.is_datatype(se))
+                    return;
+                if (m_autil.is_array(s) && m_util.is_datatype(get_array_range(s)))
+                    return;
+            }
+        }
+        m_trail_stack.push(value_trail<bool>(d->m_cycle_free));
+        d->m_cycle_free = true;
+    }
+
+    bool theory_datatype::oc_known_cycle_free(enode * n) const {
+        theory_var v = n->get_root()->get_th_var(get_id());
+        return v != null_theory_var && m_var_data[m_find.find(v)]->m_cycle_free;
+    }
+
+    bool theory_datatype::oc_cycle_free(enode * n) const {
+        return n->get_root()->is_marked2() || oc_known_cycle_free(n);
+    }
+
+    /**
+       \brief The classes of v1 and v2 were merged. Reset the cycle free flags
+       of both classes and of every class whose constructor reaches them.
+       Classes only get the flag when all their children have it, so the walk
+       over constructor parents stops at the first class without it.
+    */
+    void theory_datatype::oc_invalidate(theory_var v1, theory_var v2) {
+        bool found = false;
+        for (theory_var v : { v1, v2 }) {
+            var_data * d = m_var_data[v];
+            if (d->m_cycle_free) {
+                m_trail_stack.push(value_trail<bool>(d->m_cycle_free));
+                d->m_cycle_free = false;
+                found = true;
+            }
+        }
+        if (!found)
+            return;
+        m_oc_todo.reset();
+        m_oc_todo.push_back(get_enode(v1)->get_root());
+        for (unsigned i = 0; i < m_oc_todo.size(); ++i) {
+            enode * r = m_oc_todo[i];
+            for (enode * p : r->get_parents()) {
+                if (!is_constructor(p))
+                    continue;
+                theory_var w = p->get_root()->get_th_var(get_id());
+                if (w == null_theory_var)
+                    continue;
+                var_data * d = m_var_data[m_find.find(w)];
+                if (!d->m_cycle_free)
+                    continue;
+                m_trail_stack.push(value_trail<bool>(d->m_cycle_free));
+                d->m_cycle_free = false;
+                m_oc_todo.push_back(p->get_root());
+            }
+        }
     }
 
     void theory_datatype::oc_push_stack(enode * n) {
@@ -487,7 +557,10 @@ namespace smt {
                 sort* s = node->get_sort();
                 if (!m_util.is_datatype(s))
                     continue;
-                if (m_util.is_recursive(s) && !oc_cycle_free(node) && occurs_check(node)) {
+                if (m_util.is_recursive(s) && oc_known_cycle_free(node)) {
+                    m_stats.m_occurs_check_cached++;
+                }
+                else if (m_util.is_recursive(s) && !oc_cycle_free(node) && occurs_check(node)) {
                     // conflict was detected... 
                     // return...
                     return FC_CONTINUE;
@@ -781,6 +854,7 @@ namespace smt {
 
     void theory_datatype::collect_statistics(::statistics & st) const {
         st.update("datatype occurs check", m_stats.m_occurs_check);
+        st.update("datatype occurs check cached", m_stats.m_occurs_check_cached);
         st.update("datatype splits", m_stats.m_splits);
         st.update("datatype constructor ax", m_stats.m_assert_cnstr);
         st.update("datatype accessor ax", m_stats.m_assert_accessor);
@@ -854,6 +928,7 @@ namespace smt {
         SASSERT(v1 == static_cast<int>(m_find.find(v1)));
         var_data * d1 = m_var_data[v1];
         var_data * d2 = m_var_data[v2];
+        oc_invalidate(v1, v2);
         if (d2->m_constructor != nullptr) {
             if (d1->m_constructor != nullptr && d1->m_constructor->get_decl() != d2->m_constructor->get_decl()) {
                 enode_pair p(d1->m_constructor, d2->m_constructor);
@@ -33,13 +33,15 @@ namespace smt {
         struct var_data {
             ptr_vector<enode> m_recognizers; //!< recognizers of this equivalence class that are being watched.
             enode *           m_constructor; //!< constructor of this equivalence class, 0 if there is no constructor in the eqc.
+            bool              m_cycle_free;  //!< no cycle is reachable from this equivalence class, kept across final checks.
             var_data():
-                m_constructor(nullptr) {
+                m_constructor(nullptr),
+                m_cycle_free(false) {
             }
         };
 
         struct stats {
-            unsigned   m_occurs_check, m_splits;
+            unsigned   m_occurs_check, m_occurs_check_cached, m_splits;
             unsigned   m_assert_cnstr, m_assert_accessor, m_assert_update_field;
             void reset() { memset(this, 0, sizeof(stats)); }
             stats() { reset(); }
@@ -89,10 +91,12 @@ namespace smt {
         bool oc_on_stack(enode * n) const { return n->get_root()->is_marked(); }
 
         void oc_mark_cycle_free(enode * n);
-        bool oc_cycle_free(enode * n) const { return n->get_root()->is_marked2(); }
+        bool oc_cycle_free(enode * n) const;
+        bool oc_known_cycle_free(enode * n) const;
+        void oc_invalidate(theory_var v1, theory_var v2);
 
         void oc_push_stack(enode * n);
-        ptr_vector<enode> m_args, m_todo;
+        ptr_vector<enode> m_args, m_todo, m_oc_todo;
         ptr_vector<enode> const& get_array_args(enode* n);
         ptr_vector<enode> const& get_seq_args(enode* n, enode*& sibling);
 
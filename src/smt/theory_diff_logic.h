@@ -51,6 +51,7 @@ namespace smt {
         unsigned   m_num_core2th_eqs;
         unsigned   m_num_core2th_diseqs;
         unsigned   m_num_core2th_new_diseqs;
+        unsigned   m_num_th2core_props;
         void reset() {
             memset(this, 0, sizeof(*this));
         }
@@ -155,6 +156,27 @@ namespace smt {
             }
         };
 
+        // Justification for an atom whose edge is implied by a path through
+        // a newly asserted edge. The path is only reconstructed on demand.
+        class implied_edge_justification : public justification {
+            theory_diff_logic& m_super;
+            edge_id            m_bridge_edge;
+            edge_id            m_subsumed_edge;
+        public:
+            implied_edge_justification(theory_diff_logic& s, edge_id bridge, edge_id subsumed):
+                m_super(s), m_bridge_edge(bridge), m_subsumed_edge(subsumed) {}
+
+            void get_antecedents(conflict_resolution & cr) override {
+                m_super.get_implied_bound_antecedents(m_bridge_edge, m_subsumed_edge, cr);
+            }
+
+            proof * mk_proof(conflict_resolution & cr) override { return nullptr; }
+
+            theory_id get_from_theory() const override { return m_super.get_id(); }
+
+            char const * get_name() const override { return "dl-implied-edge"; }
+        };
+
         struct scope {
             unsigned      m_atoms_lim;
             unsigned      m_asserted_atoms_lim;
@@ -183,6 +205,7 @@ namespace smt {
         unsigned                       m_asserted_qhead;   
         bool_var2atom                  m_bool_var2atom;
         svector<scope>                 m_scopes;
+        svector<edge_id>               m_implied_edges;    // temporary
 
         unsigned                       m_num_core_conflicts;
         unsigned                       m_num_propagation_calls;
@@ -358,6 +381,8 @@ namespace smt {
 
         void get_implied_bound_antecedents(edge_id bridge_edge, edge_id subsumed_edge, conflict_resolution & cr);
 
+        void propagate_implied_edges(edge_id bridge_edge);
+
         void init_zero();
 
         theory_var get_zero(bool is_int) { return is_int ? m_izero : m_rzero; }
@@ -329,6 +329,7 @@ void theory_diff_logic<Ext>::collect_statistics(::statistics & st) const {
     st.update("dl asserts", m_stats.m_num_assertions);
     st.update("core->dl eqs", m_stats.m_num_core2th_eqs);
     st.update("core->dl diseqs", m_stats.m_num_core2th_diseqs);
+    st.update("dl->core props", m_stats.m_num_th2core_props);
     m_arith_eq_adapter.collect_statistics(st);
     m_graph.collect_statistics(st);
 }
@@ -589,9 +590,30 @@ bool theory_diff_logic<Ext>::propagate_atom(atom* a) {
         
         return false;
     }
+    if (m_params.m_arith_dl_implied_edges && !m.proofs_enabled()) 
+        propagate_implied_edges(edge_id);
     return true;
 }
 
+/**
+   \brief Assign the atoms whose edges are implied by a path of length at most two
+   through the newly enabled edge. Only the neighborhood of the edge is searched,
+   and the implying path is reconstructed only when the conflict resolution asks for it.
+*/
+template<typename Ext>
+void theory_diff_logic<Ext>::propagate_implied_edges(edge_id bridge_edge) {
+    m_implied_edges.reset();
+    m_graph.find_subsumed2(bridge_edge, m_implied_edges);
+    for (edge_id e : m_implied_edges) {
+        literal l = m_graph.get_explanation(e);
+        if (l == null_literal || ctx.get_assignment(l) != l_undef)
+            continue;
+        TRACE("arith", m_graph.display_edge(tout << "implied: ", e););
+        ++m_stats.m_num_th2core_props;
+        ctx.assign(l, ctx.mk_justification(implied_edge_justification(*this, bridge_edge, e)));
+    }
+}
+
 template<typename Ext>
 void theory_diff_logic<Ext>::new_edge(dl_var src, dl_var dst, unsigned num_edges, edge_id const* edges) {
 
@@ -1088,7 +1110,8 @@ struct imp_functor {
     conflict_resolution & m_cr;
     imp_functor(conflict_resolution& cr) : m_cr(cr) {}
     void operator()(literal l) {
-        m_cr.mark_literal(l);
+        if (l != null_literal)
+            m_cr.mark_literal(l);
     }
 };
 
@@ -34,7 +34,11 @@ namespace smt {
         m_fpa_util(m_converter.fu()),
         m_bv_util(m_converter.bu()),
         m_arith_util(m_converter.au()),
-        m_is_initialized(true)
+        m_is_initialized(true),
+        m_lazy_ops(ctx.get_manager()),
+        m_lazy_srcs(ctx.get_manager()),
+        m_lazy_consts(ctx.get_manager()),
+        m_lazy_restart(ctx.get_manager())
     {
         params_ref p;
         p.set_bool("arith_lhs", true);
@@ -179,7 +183,7 @@ namespace smt {
                 mk_ismt2_pp(res, m) << std::endl;);
         }
         else {
-            res = m_rw.convert(m_th_rw, e);
+            res = m_rw.convert(m_th_rw, abstract_lazy_ops(e));
 
             TRACE("t_fpa_detail", tout << "converted; caching:" << std::endl;
                                   tout << mk_ismt2_pp(e, m) << std::endl << " -> " << std::endl <<
@@ -244,7 +248,7 @@ namespace smt {
         literal l(ctx.mk_bool_var(atom));
         ctx.set_var_theory(l.var(), get_id());
 
-        expr_ref bv_atom(m_rw.convert_atom(m_th_rw, atom));
+        expr_ref bv_atom(m_rw.convert_atom(m_th_rw, abstract_lazy_ops(atom)));
         expr_ref bv_atom_w_side_c(m), atom_eq(m);
         bv_atom_w_side_c = m.mk_and(bv_atom, mk_side_conditions());
         m_th_rw(bv_atom_w_side_c);
@@ -504,9 +508,200 @@ namespace smt {
     final_check_status theory_fpa::final_check_eh() {
         TRACE("t_fpa", tout << "final_check_eh\n";);
         SASSERT(m_converter.m_extra_assertions.empty());
+        if (check_lazy_ops())
+            return FC_CONTINUE;
         return FC_DONE;
     }
 
+    //
+    // With fp.lazy_blast, multiplications, divisions, fused multiply-adds,
+    // square roots and remainders are replaced by fresh constants before
+    // they are converted to bit-vectors. The abstraction is sound for unsat;
+    // final_check_eh evaluates each operation on the values of its arguments
+    // and bit-blasts only the operations whose constant disagrees.
+    //
+    bool theory_fpa::is_lazy_op(app * n) const {
+        if (!ctx.get_fparams().m_fp_lazy_blast || n->get_family_id() != get_family_id())
+            return false;
+        switch (n->get_decl_kind()) {
+        case OP_FPA_MUL:
+        case OP_FPA_DIV:
+        case OP_FPA_FMA:
+        case OP_FPA_SQRT:
+        case OP_FPA_REM:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    expr_ref theory_fpa::abstract_lazy_ops(expr * e) {
+        if (!ctx.get_fparams().m_fp_lazy_blast)
+            return expr_ref(e, m);
+        obj_map<expr, expr*> cache;
+        expr_ref_vector pinned(m);
+        ptr_vector<expr> todo;
+        ptr_buffer<expr> args;
+        todo.push_back(e);
+        while (!todo.empty()) {
+            expr * t = todo.back();
+            if (cache.contains(t)) {
+                todo.pop_back();
+                continue;
+            }
+            if (!is_app(t)) {
+                cache.insert(t, t);
+                todo.pop_back();
+                continue;
+            }
+            app * a = to_app(t);
+            bool visited = true, changed = false;
+            args.reset();
+            for (expr * arg : *a) {
+                expr * r = nullptr;
+                if (cache.find(arg, r)) {
+                    args.push_back(r);
+                    changed |= r != arg;
+                }
+                else {
+                    todo.push_back(arg);
+                    visited = false;
+                }
+            }
+            if (!visited)
+                continue;
+            todo.pop_back();
+            app * r = a;
+            if (changed) {
+                r = m.mk_app(a->get_decl(), args.size(), args.data());
+                pinned.push_back(r);
+            }
+            if (is_lazy_op(a))
+                r = mk_lazy_const(a, r);
+            cache.insert(t, r);
+        }
+        return expr_ref(cache.find(e), m);
+    }
+
+    app * theory_fpa::mk_lazy_const(app * n, app * src) {
+        unsigned idx;
+        if (m_lazy_op2idx.find(n, idx))
+            return m_lazy_consts.get(idx);
+        app * k = m.mk_fresh_const("fpa_lazy", n->get_sort());
+        idx = m_lazy_ops.size();
+        m_lazy_ops.push_back(n);
+        m_lazy_srcs.push_back(src);
+        m_lazy_consts.push_back(k);
+        m_lazy_blasted.push_back(false);
+        m_lazy_op2idx.insert(n, idx);
+        m_stats.m_num_lazy_ops++;
+        TRACE("t_fpa", tout << "lazy: " << mk_ismt2_pp(n, m) << " := " << k->get_decl()->get_name() << "\n";);
+        return k;
+    }
+
+    bool theory_fpa::get_bv_value(expr * e, rational & r) {
+        if (!is_app(e) || !ctx.e_internalized(e))
+            return false;
+        auto * th = dynamic_cast<theory_bv*>(ctx.get_theory(m_bv_util.get_family_id()));
+        if (!th || ctx.get_enode(e)->get_th_var(th->get_id()) == null_theory_var)
+            return false;
+        return th->get_fixed_value(to_app(e), r);
+    }
+
+    /**
+       \brief Retrieve the floating-point or rounding-mode value of e from
+       the bits currently assigned to its bit-vector representation.
+    */
+    bool theory_fpa::get_lazy_value(expr * e, expr_ref & val) {
+        if (m_fpa_util.is_numeral(e) || m_fpa_util.is_rm_numeral(e)) {
+            val = e;
+            return true;
+        }
+        rational r;
+        if (m_fpa_util.is_fp(e)) {
+            expr_ref_vector parts(m);
+            for (expr * arg : *to_app(e)) {
+                if (!get_bv_value(arg, r))
+                    return false;
+                parts.push_back(m_bv_util.mk_numeral(r, m_bv_util.get_bv_size(arg)));
+            }
+            val = m_converter.bv2fpa_value(e->get_sort(), parts.get(0), parts.get(1), parts.get(2));
+            return true;
+        }
+        app_ref wrapped = m_converter.wrap(e);
+        if (!get_bv_value(wrapped, r))
+            return false;
+        expr_ref bv_val(m_bv_util.mk_numeral(r, m_bv_util.get_bv_size(wrapped)), m);
+        if (m_fpa_util.is_rm(e))
+            val = m_converter.bv2rm_value(bv_val);
+        else
+            val = m_converter.bv2fpa_value(e->get_sort(), bv_val);
+        return true;
+    }
+
+    bool theory_fpa::lazy_op_holds(unsigned idx) {
+        app * n = m_lazy_ops.get(idx);
+        expr_ref_vector args(m);
+        expr_ref val(m), k_val(m);
+        for (expr * arg : *n) {
+            if (!get_lazy_value(arg, val))
+                return false;
+            args.push_back(val);
+        }
+        if (!get_lazy_value(m_lazy_consts.get(idx), k_val))
+            return false;
+        val = m.mk_app(n->get_decl(), args.size(), args.data());
+        m_th_rw(val);
+        TRACE("t_fpa_detail", tout << mk_ismt2_pp(n, m) << "\nexpected: " << mk_ismt2_pp(val, m)
+              << "\nactual: " << mk_ismt2_pp(k_val, m) << "\n";);
+        if (m_fpa_util.is_nan(val) && m_fpa_util.is_nan(k_val))
+            return true;
+        return val == k_val;
+    }
+
+    void theory_fpa::blast_lazy_op(unsigned idx) {
+        app * n = m_lazy_ops.get(idx);
+        expr_ref full(m), c(m);
+        full = m_rw.convert(m_th_rw, m_lazy_srcs.get(idx));
+        m_converter.mk_eq(convert(m_lazy_consts.get(idx)), full, c);
+        m_th_rw(c);
+        assert_cnstr(c);
+        assert_cnstr(mk_side_conditions());
+        m_trail_stack.push(set_bitvector_trail(m_lazy_blasted, idx));
+        if (!ctx.at_base_level() && ctx.get_enode(n)->get_iscope_lvl() <= ctx.get_base_level())
+            m_lazy_restart.push_back(n);
+        m_stats.m_num_lazy_blasted++;
+        TRACE("t_fpa", tout << "blast: " << mk_ismt2_pp(n, m) << "\n";);
+    }
+
+    void theory_fpa::restart_eh() {
+        app_ref_vector tmp(m_lazy_restart);
+        m_lazy_restart.reset();
+        unsigned idx;
+        for (app * n : tmp) {
+            if (ctx.inconsistent())
+                break;
+            if (m_lazy_op2idx.find(n, idx) && !m_lazy_blasted[idx] && ctx.e_internalized(n))
+                blast_lazy_op(idx);
+        }
+    }
+
+    /**
+       \brief Bit-blast the relevant lazy operations whose constants do not
+       agree with their semantics. Return true if some operation was bit-blasted.
+    */
+    bool theory_fpa::check_lazy_ops() {
+        bool blasted = false;
+        for (unsigned i = 0; i < m_lazy_ops.size() && !ctx.inconsistent(); ++i) {
+            app * n = m_lazy_ops.get(i);
+            if (m_lazy_blasted[i] || !ctx.e_internalized(n) || !ctx.is_relevant(n) || lazy_op_holds(i))
+                continue;
+            blast_lazy_op(i);
+            blasted = true;
+        }
+        return blasted;
+    }
+
     void theory_fpa::init_model(model_generator & mg) {
         TRACE("t_fpa", tout << "initializing model" << std::endl; display(tout););
         m_factory = alloc(fpa_value_factory, m, get_family_id());
@@ -642,6 +837,11 @@ namespace smt {
         }
     }
 
+    void theory_fpa::collect_statistics(::statistics & st) const {
+        st.update("fpa lazy ops", m_stats.m_num_lazy_ops);
+        st.update("fpa lazy blasted", m_stats.m_num_lazy_blasted);
+    }
+
     void theory_fpa::display(std::ostream & out) const
     {
 
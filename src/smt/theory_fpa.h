@@ -76,6 +76,13 @@ namespace smt {
             app * mk_value(model_generator & mg, expr_ref_vector const & values) override;
         };
 
+        struct stats {
+            unsigned m_num_lazy_ops;
+            unsigned m_num_lazy_blasted;
+            void reset() { memset(this, 0, sizeof(stats)); }
+            stats() { reset(); }
+        };
+
     protected:
         th_rewriter               m_th_rw;
         fpa2bv_converter_wrapped  m_converter;
@@ -88,6 +95,20 @@ namespace smt {
         obj_map<expr, expr*>      m_conversions;
         bool                      m_is_initialized;
         obj_hashtable<func_decl>  m_is_added_to_model;
+        stats                     m_stats;
+
+        // fp.lazy_blast: expensive operations are replaced by fresh constants
+        // before conversion. m_lazy_srcs holds each operation applied to its
+        // abstracted arguments, which is what gets bit-blasted on refinement.
+        // The abstraction is kept across backtracking, only m_lazy_blasted is
+        // scoped. Operations internalized at the base level but bit-blasted
+        // above it are bit-blasted again at the base level on restarts.
+        app_ref_vector            m_lazy_ops;
+        app_ref_vector            m_lazy_srcs;
+        app_ref_vector            m_lazy_consts;
+        bool_vector               m_lazy_blasted;
+        obj_map<app, unsigned>    m_lazy_op2idx;
+        app_ref_vector            m_lazy_restart;
 
         final_check_status final_check_eh() override;
         bool internalize_atom(app * atom, bool gate_ctx) override;
@@ -103,6 +124,7 @@ namespace smt {
 
         model_value_proc * mk_value(enode * n, model_generator & mg) override;
 
+        void restart_eh() override;
         void assign_eh(bool_var v, bool is_true) override;
         void relevant_eh(app * n) override;
         void init_model(model_generator & m) override;
@@ -113,11 +135,21 @@ namespace smt {
         ~theory_fpa() override;
 
         void display(std::ostream & out) const override;
+        void collect_statistics(::statistics & st) const override;
 
     protected:
         expr_ref mk_side_conditions();
         expr_ref convert(expr * e);
 
+        bool is_lazy_op(app * n) const;
+        expr_ref abstract_lazy_ops(expr * e);
+        app * mk_lazy_const(app * n, app * src);
+        bool get_bv_value(expr * e, rational & r);
+        bool get_lazy_value(expr * e, expr_ref & val);
+        bool lazy_op_holds(unsigned idx);
+        void blast_lazy_op(unsigned idx);
+        bool check_lazy_ops();
+
         void attach_new_th_var(enode * n);
         void assert_cnstr(expr * e);
 
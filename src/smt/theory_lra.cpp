@@ -292,6 +292,7 @@ class theory_lra::imp {
             m_nla->settings().grobner_number_of_conflicts_to_report = prms.arith_nl_grobner_cnfl_to_report();
             m_nla->settings().grobner_quota =               prms.arith_nl_gr_q();
             m_nla->settings().grobner_frequency =           prms.arith_nl_grobner_frequency();
+            m_nla->settings().grobner_threads =             prms.arith_nl_grobner_threads();
             m_nla->settings().expensive_patching  =         false;
         }
     }
@@ -99,6 +99,34 @@ namespace smt {
         VERIFY(l_undef == normalize(false));
     }
 
+    /**
+       \brief Cache the coefficients and bound as machine integers if their
+       total stays below 2^60. Then watch sums and the bounds they are compared
+       against cannot overflow.
+    */
+    bool theory_pb::arg_t::init_small() {
+        m_coeffs64.reset();
+        m_k64 = 0;
+        numeral sum = m_k;
+        for (auto const& a : *this) {
+            if (!a.second.is_int())
+                return false;
+            sum += a.second;
+        }
+        if (!m_k.is_int() || sum >= rational::power_of_two(60)) 
+            return false;
+        m_k64 = m_k.get_int64();
+        for (auto const& a : *this) 
+            m_coeffs64.push_back(a.second.get_int64());
+        return true;
+    }
+
+    void theory_pb::arg_t::swap_args(unsigned i, unsigned j) {
+        std::swap((*this)[i], (*this)[j]);
+        if (!m_coeffs64.empty())
+            std::swap(m_coeffs64[i], m_coeffs64[j]);
+    }
+
     lbool theory_pb::arg_t::normalize(bool is_eq) {
         pb_lit_rewriter_util pbu;
         pb_rewriter_util<pb_lit_rewriter_util> util(pbu);
@@ -154,9 +182,8 @@ namespace smt {
     }
 
     void theory_pb::ineq::reset() {
-        m_max_watch.reset();
-        m_watch_sz = 0;
-        m_watch_sum.reset();
+        reset_watch();
+        m_small = false;
         m_num_propagations = 0;
         m_args[0].reset();
         m_args[0].m_k.reset();
@@ -189,6 +216,10 @@ namespace smt {
         }        
     }
 
+    void theory_pb::ineq::init_small() {
+        m_small = m_args[0].init_small() && m_args[1].init_small();
+    }
+
     void theory_pb::ineq::negate() {
         SASSERT(!m_is_eq);
         m_lit.neg();
@@ -547,6 +578,9 @@ namespace smt {
         lbool is_true = c->normalize();
         c->prune();
         c->post_prune();
+        c->init_small();
+        if (c->is_small())
+            m_stats.m_num_small_ineqs++;
 
         TRACE("pb", display(tout, *c); tout << " := " << lit << " " << is_true << "\n";);        
         switch (is_true) {
@@ -584,9 +618,9 @@ namespace smt {
 
         init_watch_ineq(*c);
         init_watch(abv);
+        TRACE("pb", display(tout, *c););
         m_var_infos[abv].m_ineq = c.detach();
         m_ineqs_trail.push_back(abv);
-        TRACE("pb", display(tout, *c););
         return true;
     }
 
@@ -644,10 +678,24 @@ namespace smt {
         watch.pop_back();
         
         SASSERT(ineq_index < c.watch_size());
+        if (c.is_small()) {
+            int64_t coeff = c.coeff64(ineq_index);
+            if (ineq_index + 1 < c.watch_size()) 
+                c.args().swap_args(ineq_index, c.watch_size()-1);
+            --c.m_watch_sz;
+            c.m_watch_sum64 -= coeff;
+            if (coeff == c.m_max_watch64) {
+                coeff = 0;
+                for (unsigned i = 0; i < c.watch_size(); ++i) 
+                    coeff = std::max(coeff, c.coeff64(i));
+                c.m_max_watch64 = coeff;
+            }
+            return;
+        }
         scoped_mpz coeff(m_mpz_mgr);
         coeff = c.ncoeff(ineq_index);
         if (ineq_index + 1 < c.watch_size()) {
-            std::swap(c.args()[ineq_index], c.args()[c.watch_size()-1]);
+            c.args().swap_args(ineq_index, c.watch_size()-1);
         }
         --c.m_watch_sz;
         c.m_watch_sum  -= coeff;
@@ -664,19 +712,26 @@ namespace smt {
 
     void theory_pb::add_watch(ineq& c, unsigned i) {
         SASSERT(c.is_ge());
-        literal lit = c.lit(i);
-        scoped_mpz coeff(m_mpz_mgr);
-        coeff = c.ncoeff(i);
-        c.m_watch_sum += coeff;
         SASSERT(i >= c.watch_size());
-        
+        literal lit = c.lit(i);
+        if (c.is_small()) {
+            int64_t coeff = c.coeff64(i);
+            c.m_watch_sum64 += coeff;
+            if (coeff > c.m_max_watch64) 
+                c.m_max_watch64 = coeff;
+        }
+        else {
+            scoped_mpz coeff(m_mpz_mgr);
+            coeff = c.ncoeff(i);
+            c.m_watch_sum += coeff;
+            if (coeff > c.max_watch()) {
+                c.set_max_watch(coeff);
+            }
+        }
         if (i > c.watch_size()) {
-            std::swap(c.args()[i], c.args()[c.watch_size()]);
+            c.args().swap_args(i, c.watch_size());
         }
         ++c.m_watch_sz;
-        if (coeff > c.max_watch()) {
-            c.set_max_watch(coeff);
-        }
         watch_literal(lit, &c);
     }
 
@@ -967,6 +1022,7 @@ namespace smt {
         st.update("pb conflicts", m_stats.m_num_conflicts);
         st.update("pb propagations", m_stats.m_num_propagations);
         st.update("pb predicates", m_stats.m_num_predicates);        
+        st.update("pb int64 ineqs", m_stats.m_num_small_ineqs);
     }
     
     void theory_pb::reset_eh() {
@@ -1144,7 +1200,8 @@ namespace smt {
         }
         else {
             init_watch_literal(c);
-            SASSERT(c.m_watch_sum >= c.mpz_k());
+            SASSERT(c.is_small() || c.m_watch_sum >= c.mpz_k());
+            SASSERT(!c.is_small() || c.m_watch_sum64 >= c.k64());
             DEBUG_CODE(validate_watch(c););
         }
 
@@ -1173,15 +1230,50 @@ namespace smt {
     }
 
 
+    /**
+       \brief Coefficients of an inequality as arbitrary precision integers.
+    */
+    struct theory_pb::mpz_view {
+        typedef scoped_mpz numeral;
+        ineq& c;
+        mpz_view(ineq& c): c(c) {}
+        numeral k() const { numeral r(c.m_mpz); r = c.mpz_k(); return r; }
+        mpz const& coeff(unsigned i) const { return c.ncoeff(i); }
+        scoped_mpz const& watch_sum() const { return c.watch_sum(); }
+        scoped_mpz const& max_watch() const { return c.max_watch(); }
+    };
+
+    /**
+       \brief Coefficients of a small inequality as machine integers.
+    */
+    struct theory_pb::int64_view {
+        typedef int64_t numeral;
+        ineq& c;
+        int64_view(ineq& c): c(c) {}
+        numeral k() const { return c.k64(); }
+        numeral coeff(unsigned i) const { return c.coeff64(i); }
+        numeral watch_sum() const { return c.m_watch_sum64; }
+        numeral max_watch() const { return c.m_max_watch64; }
+    };
+
+    bool theory_pb::assign_watch_ge(bool_var v, bool is_true, ineq_watch& watch, unsigned watch_index) {
+        if (watch[watch_index]->is_small())
+            return assign_watch_ge<int64_view>(v, is_true, watch, watch_index);
+        return assign_watch_ge<mpz_view>(v, is_true, watch, watch_index);
+    }
+
     /**
        \brief v is assigned in inequality c. Update current bounds and watch list.
        Optimize for case where the c.lit() is True. This covers the case where 
        inequalities are unit literals and formulas in negation normal form 
        (inequalities are closed under negation).       
      */
+    template<typename View>
     bool theory_pb::assign_watch_ge(bool_var v, bool is_true, ineq_watch& watch, unsigned watch_index) {
+        typedef typename View::numeral numeral;
         bool removed = false;
         ineq& c = *watch[watch_index];
+        View val(c);
         unsigned w = c.find_lit(v, 0, c.watch_size());
         SASSERT(ctx.get_assignment(c.lit()) == l_true);
         SASSERT(is_true == c.lit(w).sign());
@@ -1191,19 +1283,17 @@ namespace smt {
         // Adjust set of watched literals.
         //
         
-        scoped_mpz k_coeff(m_mpz_mgr), k(m_mpz_mgr);
-        k = c.mpz_k();
-        k_coeff = k;
-        k_coeff += c.ncoeff(w);
-        bool add_more = c.watch_sum() < k_coeff + c.max_watch();
+        numeral k = val.k();
+        numeral k_coeff = k + val.coeff(w);
+        bool add_more = val.watch_sum() < k_coeff + val.max_watch();
         for (unsigned i = c.watch_size(); add_more && i < c.size(); ++i) {
             if (ctx.get_assignment(c.lit(i)) != l_false) {
                 add_watch(c, i);
-                add_more = c.watch_sum() < k_coeff + c.max_watch();
+                add_more = val.watch_sum() < k_coeff + val.max_watch();
             }
         }        
         
-        if (c.watch_sum() < k_coeff) {
+        if (val.watch_sum() < k_coeff) {
             //
             // L: 3*x1 + 2*x2 + x4 >= 3, but x1 <- 0, x2 <- 0
             // create clause x1 or x2 or ~L
@@ -1215,8 +1305,8 @@ namespace smt {
         else {
             del_watch(watch, watch_index, c, w);
             removed = true;
-            SASSERT(c.watch_sum() >= k);
-            if (c.watch_sum() < k + c.max_watch()) {
+            SASSERT(val.watch_sum() >= k);
+            if (val.watch_sum() < k + val.max_watch()) {
                 
                 //
                 // opportunities for unit propagation for unassigned 
@@ -1230,10 +1320,9 @@ namespace smt {
 
                 literal_vector& lits = get_unhelpful_literals(c, true);
                 lits.push_back(c.lit());
-                scoped_mpz deficit(m_mpz_mgr);
-                deficit = c.watch_sum() - k;
+                numeral deficit = val.watch_sum() - k;
                 for (unsigned i = 0; i < c.size(); ++i) {
-                    if (ctx.get_assignment(c.lit(i)) == l_undef && deficit < c.ncoeff(i)) {
+                    if (ctx.get_assignment(c.lit(i)) == l_undef && deficit < val.coeff(i)) {
                         DEBUG_CODE(validate_assign(c, lits, c.lit(i)););
                         add_assign(c, lits, c.lit(i));                  
                         // break;
@@ -1429,9 +1518,7 @@ namespace smt {
             literal w = c.lit(i);
             unwatch_literal(w, &c);            
         }
-        c.m_watch_sum.reset();
-        c.m_watch_sz = 0;
-        c.m_max_watch.reset();
+        c.reset_watch();
         c.m_nfixed = 0;
         c.m_max_sum.reset();
         c.m_min_sum.reset();
@@ -1447,22 +1534,22 @@ namespace smt {
             for (unsigned i = 0; i < c.watch_size(); ++i) {
                 pb.unwatch_literal(c.lit(i), &c);
             }
-            c.m_watch_sz = 0;
-            c.m_watch_sum.reset();
-            c.m_max_watch.reset();
+            c.reset_watch();
         }        
     };
 
 
     void theory_pb::init_watch_literal(ineq& c) {
         scoped_mpz max_k(m_mpz_mgr);
-        c.m_watch_sum.reset();
-        c.m_watch_sz = 0;
-        c.m_max_watch.reset();
+        c.reset_watch();
         bool watch_more = true;
         for (unsigned i = 0; watch_more && i < c.size(); ++i) {
             if (ctx.get_assignment(c.lit(i)) != l_false) {
                 add_watch(c, i);
+                if (c.is_small()) {
+                    watch_more = c.m_watch_sum64 < c.k64() + c.m_max_watch64;
+                    continue;
+                }
                 max_k = c.mpz_k();
                 max_k += c.max_watch();
                 watch_more = c.m_watch_sum < max_k;
@@ -1475,9 +1562,7 @@ namespace smt {
         c.m_min_sum.reset();
         c.m_max_sum.reset();
         c.m_nfixed = 0;
-        c.m_watch_sum.reset();
-        c.m_max_watch.reset();
-        c.m_watch_sz = 0;
+        c.reset_watch();
         for (unsigned i = 0; i < c.size(); ++i) {
             c.m_max_sum += c.ncoeff(i);
         }                   
@@ -2052,9 +2137,18 @@ namespace smt {
                 max = c.ncoeff(i);
             }
         }
-        SASSERT(c.watch_sum() == sum);
         SASSERT(sum >= c.mpz_k());
-        SASSERT(max == c.max_watch());
+        if (c.is_small()) {
+            scoped_mpz sum64(m_mpz_mgr), max64(m_mpz_mgr);
+            m_mpz_mgr.set(sum64, c.m_watch_sum64);
+            m_mpz_mgr.set(max64, c.m_max_watch64);
+            SASSERT(m_mpz_mgr.eq(sum, sum64));
+            SASSERT(m_mpz_mgr.eq(max, max64));
+        }
+        else {
+            SASSERT(c.watch_sum() == sum);
+            SASSERT(max == c.max_watch());
+        }
     }
 
     void theory_pb::validate_assign(ineq const& c, literal_vector const& lits, literal l) const {
@@ -2278,11 +2372,13 @@ namespace smt {
         out << (c.is_ge()?" >= ":" = ") << c.k()  << "\n";
         if (c.m_num_propagations)    out << "propagations: " << c.m_num_propagations << " ";
         if (c.m_max_watch.is_pos())  out << "max_watch: "    << c.max_watch() << " ";
+        if (c.m_max_watch64 > 0)     out << "max_watch: "    << c.m_max_watch64 << " ";
         if (c.watch_size())          out << "watch size: "   << c.watch_size() << " ";
         if (c.m_watch_sum.is_pos())  out << "watch-sum: "    << c.watch_sum() << " ";
+        if (c.m_watch_sum64 > 0)     out << "watch-sum: "    << c.m_watch_sum64 << " ";
         if (!c.m_max_sum.is_zero())  out << "sum: [" << c.min_sum() << ":" << c.max_sum() << "] ";
-        if (c.m_num_propagations || c.m_max_watch.is_pos() || c.watch_size() || 
-            c.m_watch_sum.is_pos() || !c.m_max_sum.is_zero()) out << "\n";
+        if (c.m_num_propagations || c.m_max_watch.is_pos() || c.m_max_watch64 > 0 || c.watch_size() || 
+            c.m_watch_sum.is_pos() || c.m_watch_sum64 > 0 || !c.m_max_sum.is_zero()) out << "\n";
         return out;
     }
 
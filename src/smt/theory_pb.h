@@ -48,6 +48,8 @@ namespace smt {
 
         struct arg_t : public vector<std::pair<literal, numeral> > {
             numeral         m_k;        // invariants: m_k > 0, coeffs[i] > 0
+            svector<int64_t> m_coeffs64; // coefficients as machine integers, valid if init_small() succeeded.
+            int64_t         m_k64 = 0;
 
             unsigned get_hash() const;
             bool operator==(arg_t const& other) const;
@@ -87,6 +89,10 @@ namespace smt {
 
             numeral const & coeff(unsigned i) const { return (*this)[i].second; }
 
+            bool init_small();
+
+            void swap_args(unsigned i, unsigned j);
+
             std::ostream& display(context& ctx, std::ostream& out, bool values = false) const;
 
             app_ref to_expr(bool is_eq, context& ctx, ast_manager& m);
@@ -99,6 +105,7 @@ namespace smt {
             unsigned m_num_propagations;
             unsigned m_num_predicates;
             unsigned m_num_resolves;
+            unsigned m_num_small_ineqs;
             void reset() { memset(this, 0, sizeof(*this)); }
             stats() { reset(); }
         };
@@ -119,11 +126,16 @@ namespace smt {
             scoped_mpz      m_max_sum;      // maximal possible sum.
             scoped_mpz      m_min_sum;      // minimal possible sum.
             unsigned        m_num_propagations;
+            // Watch state for constraints whose coefficients and bound sum up below 2^60.
+            // For these m_max_watch and m_watch_sum are unused.
+            bool            m_small;
+            int64_t         m_max_watch64;
+            int64_t         m_watch_sum64;
             
             ineq(unsynch_mpz_manager& m, literal l, bool is_eq) : 
                 m_mpz(m), m_lit(l), m_is_eq(is_eq), 
                 m_max_watch(m), m_watch_sum(m), 
-                m_max_sum(m), m_min_sum(m) {
+                m_max_sum(m), m_min_sum(m), m_small(false) {
                 reset();
             }
 
@@ -137,6 +149,9 @@ namespace smt {
             literal lit(unsigned i) const { return args()[i].first; }
             numeral const & coeff(unsigned i) const { return args()[i].second; }
             class mpz const& ncoeff(unsigned i) const { return coeff(i).to_mpq().numerator(); }
+            int64_t k64() const { SASSERT(m_small); return args().m_k64; }
+            int64_t coeff64(unsigned i) const { SASSERT(m_small); return args().m_coeffs64[i]; }
+            bool is_small() const { return m_small; }
 
             unsigned size() const { return args().size(); }
 
@@ -144,6 +159,7 @@ namespace smt {
             scoped_mpz const& max_watch() const { return m_max_watch; }
             void set_max_watch(mpz const& n) { m_max_watch = n; }
             unsigned watch_size() const { return m_watch_sz; }
+            void reset_watch() { m_watch_sz = 0; m_watch_sum.reset(); m_max_watch.reset(); m_watch_sum64 = 0; m_max_watch64 = 0; }
 
             // variable watch infrastructure
             scoped_mpz const& min_sum() const { return m_min_sum; }
@@ -172,6 +188,8 @@ namespace smt {
 
             void post_prune();
 
+            void init_small();
+
             app_ref to_expr(context& ctx, ast_manager& m);
 
             bool is_eq() const { return m_is_eq; }
@@ -299,6 +317,10 @@ namespace smt {
         void unwatch_literal(literal w, ineq* c);
         void remove(ptr_vector<ineq>& ineqs, ineq* c);
 
+        struct mpz_view;
+        struct int64_view;
+        bool assign_watch_ge(bool_var v, bool is_true, ineq_watch& watch, unsigned index);
+        template<typename View>
         bool assign_watch_ge(bool_var v, bool is_true, ineq_watch& watch, unsigned index);
         void assign_ineq(ineq& c, bool is_true);
         void assign_eq(ineq& c, bool is_true);
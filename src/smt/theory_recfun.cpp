@@ -34,7 +34,8 @@ namespace smt {
           m_util(m_plugin.u()), 
           m_disabled_guards(m),
           m_enabled_guards(m),
-          m_preds(m) {
+          m_preds(m),
+          m_expansion_pins(m) {
         }
 
     theory_recfun::~theory_recfun() {
@@ -92,6 +93,8 @@ namespace smt {
         for (auto & kv : m_guard2pending) 
             dealloc(kv.m_value);
         m_guard2pending.reset();
+        m_expansions.reset();
+        m_expansion_pins.reset();
     }
 
     /*
@@ -220,17 +223,33 @@ namespace smt {
         }
     }
 
-     // replace `vars` by `args` in `e`
+     // replace `vars` by `args` in `e`, where `args` are the arguments of `call`.
+     // The result is cached, so re-expanding `call` after backtracking
+     // does not substitute and simplify the body again.
     expr_ref theory_recfun::apply_args(
         unsigned depth,
         recfun::vars const & vars,
         expr_ref_vector const & args,
-        expr * e) {
+        expr * e,
+        app * call) {
         SASSERT(is_standard_order(vars));
+        expr * cached = nullptr;
+        if (m_expansions.find(e, call, cached)) {
+            ++m_stats.m_cached_expansions;
+            return expr_ref(cached, m);
+        }
         var_subst subst(m, true);
         expr_ref new_body = subst(e, args);
         ctx.get_rewriter()(new_body); // simplify
         set_depth_rec(depth + 1, new_body);
+        if (m_expansions.size() >= m_max_expansions) {
+            m_expansions.reset();
+            m_expansion_pins.reset();
+        }
+        m_expansions.insert(e, call, new_body);
+        m_expansion_pins.push_back(e);
+        m_expansion_pins.push_back(call);
+        m_expansion_pins.push_back(new_body);
         return new_body;
     }
         
@@ -288,7 +307,7 @@ namespace smt {
         auto & vars = e.m_def->get_vars();
         expr_ref lhs(e.m_lhs, m);
         unsigned depth = get_depth(e.m_lhs);
-        expr_ref rhs(apply_args(depth, vars, e.m_args, e.m_def->get_rhs()), m);
+        expr_ref rhs(apply_args(depth, vars, e.m_args, e.m_def->get_rhs(), e.m_lhs), m);
         literal lit = mk_eq_lit(lhs, rhs);
         std::function<literal(void)> fn = [&]() { return lit; };
         scoped_trace_stream _tr(*this, fn);
@@ -330,7 +349,7 @@ namespace smt {
             set_depth(depth, pred_applied);
             expr_ref_vector guards(m);
             for (auto & g : c.get_guards()) {
-                guards.push_back(apply_args(depth, vars, e.m_args, g));
+                guards.push_back(apply_args(depth, vars, e.m_args, g, e.m_lhs));
             }
             if (c.is_immediate()) {
                 recfun::body_expansion be(pred_applied, c, e.m_args);
@@ -381,7 +400,7 @@ namespace smt {
         SASSERT(is_standard_order(vars));
         unsigned depth = get_depth(e.m_pred);
         expr_ref lhs(u().mk_fun_defined(d, args), m);
-        expr_ref rhs = apply_args(depth, vars, args, e.m_cdef->get_rhs());
+        expr_ref rhs = apply_args(depth, vars, args, e.m_cdef->get_rhs(), e.m_pred);
         if (has_quantifiers(rhs)) {
             expr_ref fn(m.mk_fresh_const("rec-eq", m.mk_bool_sort()), m);
             expr_ref eq(m.mk_eq(fn, rhs), m);
@@ -391,7 +410,7 @@ namespace smt {
         }
         literal_vector clause;
         for (auto & g : e.m_cdef->get_guards()) {
-            expr_ref guard = apply_args(depth, vars, args, g);
+            expr_ref guard = apply_args(depth, vars, args, g, e.m_pred);
             clause.push_back(~mk_literal(guard));
             if (clause.back() == true_literal) {
                 TRACEFN("body " << e << "\n" << clause << "\n" << guard);
@@ -486,6 +505,7 @@ namespace smt {
         st.update("recfun macro expansion", m_stats.m_macro_expansions);
         st.update("recfun case expansion", m_stats.m_case_expansions);
         st.update("recfun body expansion", m_stats.m_body_expansions);
+        st.update("recfun cached expansion", m_stats.m_cached_expansions);
     }
 
 }
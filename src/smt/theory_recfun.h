@@ -19,6 +19,7 @@ Revision History:
 #pragma once
 
 #include "util/scoped_ptr_vector.h"
+#include "util/obj_pair_hashtable.h"
 #include "smt/smt_theory.h"
 #include "smt/smt_context.h"
 #include "ast/ast_pp.h"
@@ -28,7 +29,7 @@ namespace smt {
 
     class theory_recfun : public theory {
         struct stats {
-            unsigned m_case_expansions, m_body_expansions, m_macro_expansions;
+            unsigned m_case_expansions, m_body_expansions, m_macro_expansions, m_cached_expansions;
             void reset() { memset(this, 0, sizeof(stats)); }
             stats() { reset(); }
         };
@@ -46,6 +47,12 @@ namespace smt {
         unsigned_vector          m_preds_lim;
         unsigned                 m_num_rounds { 0 };
 
+        // instantiated bodies and guards, keyed by (template, call).
+        // They only depend on the terms, so they are kept across backtracking.
+        obj_pair_map<expr, app, expr*> m_expansions;
+        expr_ref_vector          m_expansion_pins;
+        unsigned                 m_max_expansions { 1 << 16 };
+
         typedef recfun::propagation_item propagation_item;
 
         scoped_ptr_vector<propagation_item> m_propagation_queue;
@@ -69,7 +76,7 @@ namespace smt {
 
         void activate_guard(expr* guard, expr_ref_vector const& guards);
 
-        expr_ref apply_args(unsigned depth, recfun::vars const & vars, expr_ref_vector const & args, expr * e); //!< substitute variables by args
+        expr_ref apply_args(unsigned depth, recfun::vars const & vars, expr_ref_vector const & args, expr * e, app * call); //!< substitute variables by args
         void assert_macro_axiom(recfun::case_expansion & e);
         void assert_case_axioms(recfun::case_expansion & e);
         void assert_body_axiom(recfun::body_expansion & e);
@@ -296,6 +296,7 @@ void theory_seq::init() {
     params_ref p;
     p.set_bool("coalesce_chars", false);
     m_rewrite.updt_params(p);
+    m_seq_rewrite.updt_params(ctx.get_params());
 
     std::function<void(literal, literal, literal, literal, literal)> add_ax = [&](literal l1, literal l2, literal l3, literal l4, literal l5) {
         add_axiom(l1, l2, l3, l4, l5);
@@ -1869,6 +1870,7 @@ void theory_seq::collect_statistics(::statistics & st) const {
     st.update("seq fixed length", m_stats.m_fixed_length);
     st.update("seq int.to.str", m_stats.m_int_string);
     st.update("seq str.from_ubv", m_stats.m_ubv_string);
+    m_seq_rewrite.collect_statistics(st);
 }
 
 void theory_seq::init_search_eh() {
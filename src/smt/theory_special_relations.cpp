@@ -46,6 +46,8 @@ namespace smt {
         scope& s = m_scopes.back();
         s.m_asserted_atoms_lim = m_asserted_atoms.size();
         s.m_asserted_qhead_old = m_asserted_qhead;
+        s.m_reach_trail_lim = m_reach_trail.size();
+        s.m_index_qhead_old = m_index_qhead;
         m_graph.push();        
         m_ufctx.get_trail_stack().push_scope();
     }
@@ -55,6 +57,12 @@ namespace smt {
         scope& s = m_scopes[new_lvl];
         m_asserted_atoms.shrink(s.m_asserted_atoms_lim);
         m_asserted_qhead = s.m_asserted_qhead_old;
+        for (unsigned i = m_reach_trail.size(); i-- > s.m_reach_trail_lim; ) {
+            auto const& [v1, v2] = m_reach_trail[i];
+            m_reach[v1].remove(v2);
+        }
+        m_reach_trail.shrink(s.m_reach_trail_lim);
+        m_index_qhead = s.m_index_qhead_old;
         m_scopes.shrink(new_lvl);
         m_graph.pop(num_scopes);        
         m_ufctx.get_trail_stack().pop_scope(num_scopes);
@@ -65,6 +73,88 @@ namespace smt {
         if ((unsigned)v >= m_graph.get_num_nodes()) {
             m_graph.init_var(v);
         }
+        if ((unsigned)v >= m_var2node.size()) {
+            m_var2node.resize(v + 1, UINT_MAX);
+        }
+        if (m_var2node[v] != UINT_MAX) {
+            return;
+        }
+        m_var2node[v] = num_nodes();
+        m_node2var.push_back(v);
+        m_reach.push_back(uint_set());
+        m_atoms_of.push_back(atoms());
+        if (num_nodes() > m_max_index_nodes) {
+            m_use_index = false;
+        }
+    }
+
+    bool theory_special_relations::relation::insert_reach(unsigned n1, unsigned n2) {
+        if (n1 == n2 || m_reach[n1].contains(n2)) {
+            return false;
+        }
+        m_reach[n1].insert(n2);
+        m_reach_trail.push_back(std::make_pair(n1, n2));
+        return true;
+    }
+
+    /**
+       \brief update the closure with the edge u <= v.
+       Every node that reaches u now reaches v and all nodes reachable from v.
+       The nodes whose reach set grew are added to affected.
+     */
+    void theory_special_relations::relation::add_reach(theory_var u, theory_var v, svector<theory_var>& affected) {
+        if (reaches(u, v)) {
+            return;
+        }
+        unsigned nu = node(u), nv = node(v);
+        for (unsigned x = 0; x < num_nodes(); ++x) {
+            if (x == nv || (x != nu && !m_reach[x].contains(nu))) {
+                continue;
+            }
+            bool grew = insert_reach(x, nv);
+            for (unsigned w : m_reach[nv]) {
+                grew |= insert_reach(x, w);
+            }
+            if (grew) {
+                affected.push_back(m_node2var[x]);
+            }
+        }
+    }
+
+    /**
+       \brief collect the explanation of a path src <= dst into m_explanation.
+       The breadth-first search only enters nodes that reach dst according to the index.
+     */
+    bool theory_special_relations::relation::explain_reach(theory_var src, theory_var dst) {
+        if (src == dst) {
+            return true;
+        }
+        u_map<edge_id> parent;
+        svector<theory_var> todo;
+        parent.insert(src, null_edge_id);
+        todo.push_back(src);
+        for (unsigned head = 0; head < todo.size(); ++head) {
+            for (edge_id e : m_graph.get_out_edges(todo[head])) {
+                if (!m_graph.is_enabled(e)) {
+                    continue;
+                }
+                theory_var w = m_graph.get_target(e);
+                if (parent.contains(w) || !reaches(w, dst)) {
+                    continue;
+                }
+                parent.insert(w, e);
+                if (w == dst) {
+                    while (w != src) {
+                        e = parent[w];
+                        m_explanation.append(m_graph.get_explanation(e));
+                        w = m_graph.get_source(e);
+                    }
+                    return true;
+                }
+                todo.push_back(w);
+            }
+        }
+        return false;
     }
 
     bool theory_special_relations::relation::new_eq_eh(literal l, theory_var v1, theory_var v2) {
@@ -150,6 +240,7 @@ namespace smt {
         ctx.set_var_theory(v, get_id());
         atom* a = alloc(atom, v, *r, v0, v1);
         m_atoms.push_back(a);
+        r->atoms_of(v0).push_back(a);
         TRACE("special_relations", tout << mk_pp(atm, m) << " : bv" << v << " v" << a->v1() << " v" << a->v2() << ' ' << gate_ctx << "\n";);
         m_bool_var2atom.insert(v, a);
         return true;
@@ -585,6 +676,12 @@ namespace smt {
             if (!a.phase() && r.m_uf.find(a.v1()) == r.m_uf.find(a.v2())) {
                 // v1 !-> v2
                 // find v1 -> v3 -> v4 -> v2 path
+                if (r.m_use_index) {
+                    if (r.reaches(a.v1(), a.v2())) {
+                        return reach_conflict(a);
+                    }
+                    continue;
+                }
                 r.m_explanation.reset();
                 unsigned timestamp = r.m_graph.get_timestamp();
                 bool found_path = r.m_graph.find_shortest_reachable_path(a.v1(), a.v2(), timestamp, r);
@@ -631,17 +728,76 @@ namespace smt {
                 }
                 break;
             }
+            if (res == l_true && r.m_use_index && !a.phase() && r.reaches(a.v1(), a.v2())) {
+                res = reach_conflict(a);
+            }
             ++r.m_asserted_qhead;
         }
+        if (res == l_true) {
+            res = propagate_index(r);
+        }
         return res;
     }
 
+    /**
+       \brief fold newly enabled edges into the reachability index and
+       assign the atoms v1 <= v2 that become implied by it.
+       Returns l_false if some literal was assigned.
+     */
+    lbool theory_special_relations::propagate_index(relation& r) {
+        if (!r.m_use_index) {
+            return l_true;
+        }
+        lbool res = l_true;
+        auto const& edges = r.m_graph.get_enabled_edges();
+        while (r.m_index_qhead < edges.size() && !ctx.inconsistent()) {
+            edge_id e = edges[r.m_index_qhead++];
+            m_reach_affected.reset();
+            r.add_reach(r.m_graph.get_source(e), r.m_graph.get_target(e), m_reach_affected);
+            for (theory_var x : m_reach_affected) {
+                for (atom* a : r.atoms_of(x)) {
+                    literal lit(a->var());
+                    if (ctx.get_assignment(lit) == l_true || !r.reaches(x, a->v2())) {
+                        continue;
+                    }
+                    r.m_explanation.reset();
+                    VERIFY(r.explain_reach(x, a->v2()));
+                    literal_vector const& lits = r.m_explanation;
+                    TRACE("special_relations", ctx.display_literals_verbose(tout << "reach " << lit << " <- ", lits) << "\n";);
+                    ++m_stats.m_num_reach_propagations;
+                    ctx.assign(lit, ctx.mk_justification(
+                                   ext_theory_propagation_justification(
+                                       get_id(), ctx, lits.size(), lits.data(), 0, nullptr, lit)));
+                    res = l_false;
+                    if (ctx.inconsistent()) {
+                        return l_false;
+                    }
+                }
+            }
+        }
+        return res;
+    }
+
+    /**
+       \brief the atom v1 !<= v2 is asserted, but the index has v1 <= v2.
+     */
+    lbool theory_special_relations::reach_conflict(atom& a) {
+        relation& r = a.get_relation();
+        r.m_explanation.reset();
+        VERIFY(r.explain_reach(a.v1(), a.v2()));
+        r.m_explanation.push_back(a.explanation());
+        ++m_stats.m_num_reach_conflicts;
+        set_conflict(r);
+        return l_false;
+    }
+
     void theory_special_relations::reset_eh() {
+        del_atoms(0);
         for (auto const& kv : m_relations) {
             dealloc(kv.m_value);
         }
         m_relations.reset();
-        del_atoms(0);
+        m_stats.reset();
     }
 
     void theory_special_relations::assign_eh(bool_var v, bool is_true) {
@@ -677,6 +833,9 @@ namespace smt {
             --it;
             atom* a = *it;
             m_bool_var2atom.erase(a->var());
+            atoms& as = a->get_relation().atoms_of(a->v1());
+            SASSERT(as.back() == a);
+            as.pop_back();
             dealloc(a);
         }
         m_atoms.shrink(old_size);
@@ -684,6 +843,8 @@ namespace smt {
 
 
     void theory_special_relations::collect_statistics(::statistics & st) const {
+        st.update("special relations reach propagations", m_stats.m_num_reach_propagations);
+        st.update("special relations reach conflicts", m_stats.m_num_reach_conflicts);
         for (auto const& kv : m_relations) {
             kv.m_value->m_graph.collect_statistics(st);
         }
@@ -23,6 +23,7 @@ Notes:
 #include "smt/smt_theory.h"
 #include "smt/theory_diff_logic.h"
 #include "util/union_find.h"
+#include "util/uint_set.h"
 #include "util/rational.h"
 
 namespace smt {
@@ -72,6 +73,15 @@ namespace smt {
         struct scope {
             unsigned m_asserted_atoms_lim;
             unsigned m_asserted_qhead_old;
+            unsigned m_reach_trail_lim;
+            unsigned m_index_qhead_old;
+        };
+
+        struct stats {
+            unsigned m_num_reach_propagations;
+            unsigned m_num_reach_conflicts;
+            void reset() { memset(this, 0, sizeof(*this)); }
+            stats() { reset(); }
         };
 
         struct int_ext : public sidl_ext {
@@ -103,7 +113,22 @@ namespace smt {
             union_find_t           m_uf;
             literal_vector         m_explanation;
 
-            relation(sr_property p, func_decl* d, ast_manager& m): m(m), m_next(m), m_property(p), m_decl(d), m_asserted_qhead(0), m_uf(m_ufctx) {}
+            // transitive closure of the enabled edges in m_graph, over the nodes of this relation.
+            // Theory variables are shared by all relations, so the index numbers the variables
+            // of the relation by the order in which they were registered.
+            // m_reach[n] holds the nodes k != n such that n <= k follows from the edges.
+            bool                   m_use_index;
+            unsigned               m_max_index_nodes;
+            unsigned               m_index_qhead;      // enabled edges already folded into m_reach
+            unsigned_vector        m_var2node;
+            svector<theory_var>    m_node2var;
+            vector<uint_set>       m_reach;
+            svector<std::pair<unsigned, unsigned>> m_reach_trail;
+            vector<atoms>          m_atoms_of;         // node of v1 -> atoms v1 <= v2
+
+            relation(sr_property p, func_decl* d, ast_manager& m): 
+                m(m), m_next(m), m_property(p), m_decl(d), m_asserted_qhead(0), m_uf(m_ufctx),
+                m_use_index(p != sr_tc), m_max_index_nodes(1 << 12), m_index_qhead(0) {}
 
             func_decl* decl() { return m_decl; }
 
@@ -122,6 +147,14 @@ namespace smt {
 
             bool add_strict_edge(theory_var v1, theory_var v2, literal_vector const& j);
             bool add_non_strict_edge(theory_var v1, theory_var v2, literal_vector const& j);
+
+            unsigned node(theory_var v) const { return m_var2node[v]; }
+            unsigned num_nodes() const { return m_node2var.size(); }
+            atoms& atoms_of(theory_var v) { return m_atoms_of[node(v)]; }
+            bool reaches(theory_var v1, theory_var v2) const { return v1 == v2 || m_reach[node(v1)].contains(node(v2)); }
+            void add_reach(theory_var u, theory_var v, svector<theory_var>& affected);
+            bool insert_reach(unsigned n1, unsigned n2);
+            bool explain_reach(theory_var src, theory_var dst);
             
             std::ostream& display(theory_special_relations const& sr, std::ostream& out) const;
         };
@@ -134,6 +167,8 @@ namespace smt {
         obj_map<func_decl, relation*>  m_relations;
         bool_var2atom                  m_bool_var2atom;
         bool                           m_can_propagate;
+        stats                          m_stats;
+        svector<theory_var>            m_reach_affected;
         
 
         void del_atoms(unsigned old_size);
@@ -144,6 +179,8 @@ namespace smt {
         lbool final_check_to(relation& r);
         lbool final_check_tc(relation& r);
         lbool propagate(relation& r);
+        lbool propagate_index(relation& r);
+        lbool reach_conflict(atom& a);
         lbool enable(atom& a);
         bool  extract_equalities(relation& r);
         void set_neg_cycle_conflict(relation& r);
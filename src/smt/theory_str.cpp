@@ -80,6 +80,8 @@ namespace smt {
         loopDetected(false),
         m_theoryStrOverlapAssumption_term(m.mk_true(), m),
         contains_map(m),
+        m_regex_automaton_cache_terms(m),
+        m_regex_automaton_cache_states(0),
         string_int_conversion_terms(m),
         totalCacheAccessCount(0),
         cacheHitCount(0),
@@ -95,10 +97,6 @@ namespace smt {
 
     theory_str::~theory_str() {
         m_trail_stack.reset();
-        for (eautomaton * aut : regex_automata) {
-            dealloc(aut);
-        }
-        regex_automata.clear();
         for (auto& kv: var_to_char_subterm_map) dealloc(kv.m_value);
         for (auto& kv: uninterpreted_to_char_subterm_map) dealloc(kv.m_value);
     }
@@ -135,7 +133,6 @@ namespace smt {
         contain_pair_idx_map.reset();
 
         m_automata.reset();
-        regex_automata.reset();
         regex_terms.reset();
         regex_terms_by_string.reset();
         regex_automaton_assumptions.reset();
@@ -198,6 +195,10 @@ namespace smt {
         st.update("str refine negated equation", m_stats.m_refine_neq);
         st.update("str refine function", m_stats.m_refine_f);
         st.update("str refine negated function", m_stats.m_refine_nf);
+        st.update("str regex automata", m_stats.m_regex_automata);
+        st.update("str regex automaton cache hits", m_stats.m_regex_automaton_hits);
+        st.update("str regex products", m_stats.m_regex_products);
+        st.update("str regex product cache hits", m_stats.m_regex_product_hits);
     }
 
     void theory_str::assert_axiom(expr * _e) {
@@ -8573,7 +8574,8 @@ namespace smt {
 
             expr_ref_vector precondition(m);
             expr_ref_vector cex(m);
-            lbool model_status = fixed_length_model_construction(assignments, precondition, free_variables, candidate_model, cex);
+            bool giveup = false;
+            lbool model_status = fixed_length_model_construction(assignments, precondition, free_variables, candidate_model, cex, giveup);
 
             if (model_status == l_true) {
                 m_stats.m_solved_by = 2;
@@ -8585,6 +8587,9 @@ namespace smt {
                 assert_axiom(conflict);
                 add_persisted_axiom(conflict);
                 return FC_CONTINUE;
+            } else if (giveup) {
+                TRACE("str", tout << "fixed-length model construction cannot reduce all constraints; giving up" << std::endl;);
+                return FC_GIVEUP;
             } else { // model_status == l_undef
                 TRACE("str", tout << "fixed-length model construction found missing side conditions; continuing search" << std::endl;);
                 return FC_CONTINUE;
@@ -20,6 +20,7 @@
 #include "util/union_find.h"
 #include "util/scoped_ptr_vector.h"
 #include "util/hashtable.h"
+#include "util/map.h"
 #include "ast/ast_pp.h"
 #include "ast/arith_decl_plugin.h"
 #include "ast/rewriter/th_rewriter.h"
@@ -303,6 +304,10 @@ class theory_str : public theory {
         unsigned m_refine_nf;
         unsigned m_solved_by;
         unsigned m_fixed_length_iterations;
+        unsigned m_regex_automata;
+        unsigned m_regex_automaton_hits;
+        unsigned m_regex_products;
+        unsigned m_regex_product_hits;
     };
 
 protected:
@@ -437,8 +442,17 @@ protected:
     obj_map<expr, std::set<std::pair<expr*, expr*> > > contain_pair_idx_map;
 
     // regex automata
-    scoped_ptr_vector<eautomaton> m_automata;
-    ptr_vector<eautomaton> regex_automata;
+    scoped_ptr_vector<eautomaton> m_automata; // automata released at the start of each search
+
+    // automata for regex terms and their products, kept across searches and push/pop
+    typedef std::pair<eautomaton*, eautomaton*> automaton_pair;
+    typedef map<automaton_pair, eautomaton*, pair_hash<ptr_hash<eautomaton>, ptr_hash<eautomaton> >, default_eq<automaton_pair> > automaton_product_cache;
+    scoped_ptr_vector<eautomaton> m_cached_automata;
+    ptr_addr_hashtable<eautomaton> m_cached_automata_set;
+    obj_map<expr, eautomaton*> m_regex_automaton_cache; // RegEx --> automaton
+    expr_ref_vector m_regex_automaton_cache_terms;
+    automaton_product_cache m_automaton_product_cache;
+    unsigned m_regex_automaton_cache_states;
     obj_hashtable<expr> regex_terms;
     obj_map<expr, ptr_vector<expr> > regex_terms_by_string; // S --> [ (str.in.re S *) ]
     obj_map<expr, svector<regex_automaton_under_assumptions> > regex_automaton_assumptions; // RegEx --> [ aut+assumptions ]
@@ -568,6 +582,9 @@ protected:
 
     // regex automata and length-aware regex
     bool solve_regex_automata();
+    bool cache_automaton(eautomaton * aut);
+    eautomaton * get_regex_automaton(expr * re);
+    eautomaton * get_automaton_product(eautomaton * aut1, eautomaton * aut2);
     unsigned estimate_regex_complexity(expr * re);
     unsigned estimate_regex_complexity_under_complement(expr * re);
     unsigned estimate_automata_intersection_difficulty(eautomaton * aut1, eautomaton * aut2);
@@ -699,7 +716,7 @@ protected:
 
     lbool fixed_length_model_construction(expr_ref_vector formulas, expr_ref_vector &precondition,
             expr_ref_vector& free_variables,
-            obj_map<expr, zstring> &model, expr_ref_vector &cex);
+            obj_map<expr, zstring> &model, expr_ref_vector &cex, bool &giveup);
     bool fixed_length_reduce_string_term(smt::kernel & subsolver, expr * term, expr_ref_vector & term_chars, expr_ref & cex);
     bool fixed_length_get_len_value(expr * e, rational & val);
     bool fixed_length_reduce_eq(smt::kernel & subsolver, expr_ref lhs, expr_ref rhs, expr_ref & cex);
@@ -710,7 +727,7 @@ protected:
     bool fixed_length_reduce_negative_prefix(smt::kernel & subsolver, expr_ref f, expr_ref & cex);
     bool fixed_length_reduce_suffix(smt::kernel & subsolver, expr_ref f, expr_ref & cex);
     bool fixed_length_reduce_negative_suffix(smt::kernel & subsolver, expr_ref f, expr_ref & cex);
-    bool fixed_length_reduce_regex_membership(smt::kernel & subsolver, expr_ref f, expr_ref & cex, bool polarity);
+    lbool fixed_length_reduce_regex_membership(smt::kernel & subsolver, expr_ref f, expr_ref & cex, bool polarity);
 
     void dump_assignments();
 
@@ -442,7 +442,13 @@ namespace smt {
 
     }
 
-    bool theory_str::fixed_length_reduce_regex_membership(smt::kernel & subsolver, expr_ref f, expr_ref & cex, bool polarity) {
+    /*
+     * Reduce the regex membership f (or its negation if polarity is false) to constraints
+     * over the characters of its string term in the subsolver, and return l_true.
+     * Return l_false if a conflict clause was produced in cex, and l_undef if
+     * no automaton can be built for the regex.
+     */
+    lbool theory_str::fixed_length_reduce_regex_membership(smt::kernel & subsolver, expr_ref f, expr_ref & cex, bool polarity) {
         ast_manager & m = get_manager();
 
         ast_manager & sub_m = subsolver.m();
@@ -450,13 +456,15 @@ namespace smt {
         expr * str = nullptr, *re = nullptr;
         VERIFY(u.str.is_in_re(f, str, re));
 
-        // TODO reuse some of the automaton framework from theory_str_regex
-        eautomaton * aut = m_mk_aut(re);
-        aut->compress();
+        eautomaton * aut = get_regex_automaton(re);
+        if (aut == nullptr) {
+            TRACE("str_fl", tout << "no automaton for " << mk_pp(re, m) << std::endl;);
+            return l_undef;
+        }
 
         expr_ref_vector str_chars(m);
         if (!fixed_length_reduce_string_term(subsolver, str, str_chars, cex)) {
-            return false;
+            return l_false;
         }
 
         if (str_chars.empty()) {
@@ -479,15 +487,15 @@ namespace smt {
                 TRACE("str_fl", tout << "contradiction: regex has no zero-length solutions, but our string must be a solution" << std::endl;);
                 cex = m.mk_or(m.mk_not(f), m.mk_not(ctx.mk_eq_atom(mk_strlen(str), mk_int(0))));
                 ctx.get_rewriter()(cex);
-                return false;
+                return l_false;
             } else if (zero_solution && !polarity) {
                 TRACE("str_fl", tout << "contradiction: regex has zero-length solutions, but our string must not be a solution" << std::endl;);
                 cex = m.mk_or(f, m.mk_not(ctx.mk_eq_atom(mk_strlen(str), mk_int(0))));
                 ctx.get_rewriter()(cex);
-                return false;
+                return l_false;
             } else {
                 TRACE("str_fl", tout << "regex constraint satisfied without asserting constraints to subsolver" << std::endl;);
-                return true;
+                return l_true;
             }
         } else {
             expr_ref_vector trail(m);
@@ -579,17 +587,17 @@ namespace smt {
                             } else {
                                 // this is strange, since we knew the length of `str` in order to get here
                                 cex = expr_ref(m_autil.mk_ge(mk_strlen(str_term), mk_int(0)), m);
-                                return false;
+                                return l_false;
                             }
                         }
                     }
 
                     cex = m.mk_or(m.mk_not(f), m.mk_not(mk_and(str_terms_eq_len)));
                     ctx.get_rewriter()(cex);
-                    return false;
+                    return l_false;
                 } else {
                     TRACE("str_fl", tout << "regex constraint satisfied without asserting constraints to subsolver" << std::endl;);
-                    return true;
+                    return l_true;
                 }
             } else {
                 if (polarity) {
@@ -599,7 +607,7 @@ namespace smt {
                     fixed_length_assumptions.push_back(sub_m.mk_not(result));
                     fixed_length_lesson.insert(sub_m.mk_not(result), std::make_tuple(NFUN, f, f));
                 }
-                return true;
+                return l_true;
             }
         }
     }
@@ -883,7 +891,7 @@ namespace smt {
 
     lbool theory_str::fixed_length_model_construction(expr_ref_vector formulas, expr_ref_vector &precondition,
             expr_ref_vector& free_variables,
-            obj_map<expr, zstring> &model, expr_ref_vector &cex) {
+            obj_map<expr, zstring> &model, expr_ref_vector &cex, bool &giveup) {
 
         ast_manager & m = get_manager();
 
@@ -981,7 +989,12 @@ namespace smt {
                     TRACE("str_fl", tout << "reduce regex membership: " << mk_pp(f, m) << std::endl;);
                     expr_ref cex_clause(m);
                     expr_ref re(f, m);
-                    if (!fixed_length_reduce_regex_membership(subsolver, re, cex_clause, true)) {
+                    lbool reduced = fixed_length_reduce_regex_membership(subsolver, re, cex_clause, true);
+                    if (reduced == l_undef) {
+                        giveup = true;
+                        return l_undef;
+                    }
+                    if (reduced == l_false) {
                         assert_axiom(cex_clause);
                         add_persisted_axiom(cex_clause);
                         return l_undef;
@@ -1045,7 +1058,12 @@ namespace smt {
                         TRACE("str_fl", tout << "reduce negative regex membership: " << mk_pp(f, m) << std::endl;);
                         expr_ref cex_clause(m);
                         expr_ref re(subterm, m);
-                        if (!fixed_length_reduce_regex_membership(subsolver, re, cex_clause, false)) {
+                        lbool reduced = fixed_length_reduce_regex_membership(subsolver, re, cex_clause, false);
+                        if (reduced == l_undef) {
+                            giveup = true;
+                            return l_undef;
+                        }
+                        if (reduced == l_false) {
                             assert_axiom(cex_clause);
                             add_persisted_axiom(cex_clause);
                             return l_undef;
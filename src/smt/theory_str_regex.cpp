@@ -43,6 +43,68 @@ namespace smt {
         return static_cast<unsigned>(result);
     }
 
+    /*
+     * Take ownership of `aut`. Automata are kept in the persistent cache while
+     * its total number of states stays within RegexAutomata_CacheMaxStates,
+     * otherwise they are released at the start of the next search.
+     */
+    bool theory_str::cache_automaton(eautomaton * aut) {
+        unsigned sz = aut->num_states();
+        if (m_regex_automaton_cache_states + sz > m_params.m_RegexAutomata_CacheMaxStates) {
+            m_automata.push_back(aut);
+            return false;
+        }
+        m_regex_automaton_cache_states += sz;
+        m_cached_automata.push_back(aut);
+        m_cached_automata_set.insert(aut);
+        return true;
+    }
+
+    /*
+     * Return the (compressed) automaton for the regex term `re`, or nullptr if it
+     * cannot be built. The automaton only depends on the regex term, so it is
+     * reused across constraints, push/pop and check-sat calls.
+     */
+    eautomaton * theory_str::get_regex_automaton(expr * re) {
+        eautomaton * aut = nullptr;
+        if (m_regex_automaton_cache.find(re, aut)) {
+            m_stats.m_regex_automaton_hits++;
+            return aut;
+        }
+        aut = m_mk_aut(re);
+        if (aut == nullptr) {
+            return nullptr;
+        }
+        m_stats.m_regex_automata++;
+        if (cache_automaton(aut)) {
+            m_regex_automaton_cache.insert(re, aut);
+            m_regex_automaton_cache_terms.push_back(re);
+        }
+        return aut;
+    }
+
+    /*
+     * Return the product of `aut1` and `aut2`. Products of cached automata are cached as well.
+     */
+    eautomaton * theory_str::get_automaton_product(eautomaton * aut1, eautomaton * aut2) {
+        std::pair<eautomaton*, eautomaton*> key(aut1, aut2);
+        bool cacheable = m_cached_automata_set.contains(aut1) && m_cached_automata_set.contains(aut2);
+        eautomaton * result = nullptr;
+        if (cacheable && m_automaton_product_cache.find(key, result)) {
+            m_stats.m_regex_product_hits++;
+            return result;
+        }
+        result = m_mk_aut.mk_product(aut1, aut2);
+        m_stats.m_regex_products++;
+        if (!cacheable) {
+            m_automata.push_back(result);
+        }
+        else if (cache_automaton(result)) {
+            m_automaton_product_cache.insert(key, result);
+        }
+        return result;
+    }
+
     // Returns false if we need to give up solving, e.g. because we found symbolic expressions in an automaton.
     bool theory_str::solve_regex_automata() {
         for (auto str_in_re : regex_terms) {
@@ -201,13 +263,11 @@ namespace smt {
                     if (expected_complexity <= m_params.m_RegexAutomata_DifficultyThreshold || regex_get_counter(regex_fail_count, str_in_re) >= m_params.m_RegexAutomata_FailedAutomatonThreshold) {
                         CTRACE("str", regex_get_counter(regex_fail_count, str_in_re) >= m_params.m_RegexAutomata_FailedAutomatonThreshold,
                                 tout << "failed automaton threshold reached for " << mk_pp(str_in_re, m) << " -- automatically constructing full automaton" << std::endl;);
-                        eautomaton * aut = m_mk_aut(re);
+                        eautomaton * aut = get_regex_automaton(re);
                         if (aut == nullptr) {
                             TRACE("str", tout << "ERROR: symbolic automaton construction failed, likely due to non-constant term in regex" << std::endl;);
                             return false;
                         }
-                        aut->compress();
-                        regex_automata.push_back(aut);
                         regex_automaton_under_assumptions new_aut(re, aut, true);
                         if (!regex_automaton_assumptions.contains(re)) {
                             regex_automaton_assumptions.insert(re, svector<regex_automaton_under_assumptions>());
@@ -339,13 +399,11 @@ namespace smt {
                     unsigned expected_complexity = estimate_regex_complexity(re);
                     bool failureThresholdExceeded = (regex_get_counter(regex_fail_count, str_in_re) >= m_params.m_RegexAutomata_FailedAutomatonThreshold);
                     if (expected_complexity <= m_params.m_RegexAutomata_DifficultyThreshold || failureThresholdExceeded) {
-                        eautomaton * aut = m_mk_aut(re);
+                        eautomaton * aut = get_regex_automaton(re);
                         if (aut == nullptr) {
                             TRACE("str", tout << "ERROR: symbolic automaton construction failed, likely due to non-constant term in regex" << std::endl;);
                             return false;
                         }
-                        aut->compress();
-                        regex_automata.push_back(aut);
                         regex_automaton_under_assumptions new_aut(re, aut, true);
                         if (!regex_automaton_assumptions.contains(re)) {
                             regex_automaton_assumptions.insert(re, svector<regex_automaton_under_assumptions>());
@@ -449,13 +507,11 @@ namespace smt {
                         unsigned expected_complexity = estimate_regex_complexity(re);
                         bool failureThresholdExceeded = (regex_get_counter(regex_fail_count, str_in_re) >= m_params.m_RegexAutomata_FailedAutomatonThreshold);
                         if (expected_complexity <= m_params.m_RegexAutomata_DifficultyThreshold || failureThresholdExceeded) {
-                            eautomaton * aut = m_mk_aut(re);
+                            eautomaton * aut = get_regex_automaton(re);
                             if (aut == nullptr) {
                                 TRACE("str", tout << "ERROR: symbolic automaton construction failed, likely due to non-constant term in regex" << std::endl;);
                                 return false;
                             }
-                            aut->compress();
-                            regex_automata.push_back(aut);
                             regex_automaton_under_assumptions new_aut(re, aut, true);
                             if (!regex_automaton_assumptions.contains(re)) {
                                 regex_automaton_assumptions.insert(re, svector<regex_automaton_under_assumptions>());
@@ -485,13 +541,11 @@ namespace smt {
                         unsigned expected_complexity = estimate_regex_complexity(re);
                         if (expected_complexity <= m_params.m_RegexAutomata_DifficultyThreshold
                                 || failureThresholdExceeded) {
-                            eautomaton * aut = m_mk_aut(re);
+                            eautomaton * aut = get_regex_automaton(re);
                             if (aut == nullptr) {
                                 TRACE("str", tout << "ERROR: symbolic automaton construction failed, likely due to non-constant term in regex" << std::endl;);
                                 return false;
                             }
-                            aut->compress();
-                            regex_automata.push_back(aut);
                             regex_automaton_under_assumptions new_aut(re, aut, true);
                             if (!regex_automaton_assumptions.contains(re)) {
                                 regex_automaton_assumptions.insert(re, svector<regex_automaton_under_assumptions>());
@@ -601,32 +655,27 @@ namespace smt {
                         lbool current_assignment = ctx.get_assignment(str_in_re_term);
                         // if the assignment is consistent with our assumption, use the automaton directly;
                         // otherwise, complement it (and save that automaton for next time)
-                        // TODO we should cache these intermediate results
-                        // TODO do we need to push the intermediates into a vector for deletion anyway?
                         if ( (current_assignment == l_true && aut.get_polarity())
                                 || (current_assignment == l_false && !aut.get_polarity())) {
                             if (aut_inter == nullptr) {
                                 aut_inter = aut.get_automaton();
                             } else {
-                                aut_inter = m_mk_aut.mk_product(aut_inter, aut.get_automaton());
-                                m_automata.push_back(aut_inter);
+                                aut_inter = get_automaton_product(aut_inter, aut.get_automaton());
                             }
                         } else {
                             // need to complement first
                             expr_ref rc(u.re.mk_complement(aut.get_regex_term()), m);
-                            eautomaton * aut_c = m_mk_aut(rc);
+                            eautomaton * aut_c = get_regex_automaton(rc);
                             if (aut_c == nullptr) {
                                 TRACE("str", tout << "ERROR: symbolic automaton construction failed, likely due to non-constant term in regex" << std::endl;);
                                 return false;
                             }
-                            regex_automata.push_back(aut_c);
                             // TODO is there any way to build a complement automaton from an existing one?
                             // this discards length information
                             if (aut_inter == nullptr) {
                                 aut_inter = aut_c;
                             } else {
-                                aut_inter = m_mk_aut.mk_product(aut_inter, aut_c);
-                                m_automata.push_back(aut_inter);
+                                aut_inter = get_automaton_product(aut_inter, aut_c);
                             }
                         }
                         used_intersect_constraints.push_back(aut);
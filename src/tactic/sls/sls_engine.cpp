@@ -22,6 +22,8 @@ Notes:
 #include "ast/ast_smt2_pp.h"
 #include "ast/ast_pp.h"
 #include "ast/rewriter/var_subst.h"
+#include "ast/ast_translation.h"
+#include "util/scoped_ptr_vector.h"
 #include "model/model_pp.h"
 #include "tactic/tactic.h"
 #include "util/luby.h"
@@ -52,6 +54,7 @@ sls_engine::~sls_engine() {
 
 void sls_engine::updt_params(params_ref const & _p) {
     sls_params p(_p);
+    m_params.append(_p);
     m_produce_models = _p.get_bool("model", false);
     m_max_restarts = p.max_restarts();
     m_tracker.set_random_seed(p.random_seed());
@@ -70,6 +73,7 @@ void sls_engine::updt_params(params_ref const & _p) {
     m_early_prune = p.early_prune();
     m_random_offset = p.random_offset();
     m_rescore = p.rescore();
+    m_threads = p.threads();
 
     // Andreas: Would cause trouble because repick requires an assertion being picked before which is not the case in GSAT.
     if (m_walksat_repick && !m_walksat)
@@ -191,6 +195,11 @@ bool sls_engine::what_if(
 }
 
 void sls_engine::mk_add(unsigned bv_sz, const mpz & old_value, mpz & add_value, mpz & result) {
+    if (bv_sz <= 64 && m_mpz_manager.is_uint64(add_value)) {
+        uint64_t mask = bv_sz == 64 ? UINT64_MAX : (static_cast<uint64_t>(1) << bv_sz) - 1;
+        m_mpz_manager.set(result, (m_mpz_manager.get_uint64(old_value) + m_mpz_manager.get_uint64(add_value)) & mask);
+        return;
+    }
     mpz temp, mask, mask2;
     m_mpz_manager.add(old_value, add_value, temp);
     m_mpz_manager.set(mask, m_powers(bv_sz));
@@ -203,6 +212,11 @@ void sls_engine::mk_add(unsigned bv_sz, const mpz & old_value, mpz & add_value,
 }
 
 void sls_engine::mk_inc(unsigned bv_sz, const mpz & old_value, mpz & incremented) {
+    if (bv_sz <= 64) {
+        uint64_t mask = bv_sz == 64 ? UINT64_MAX : (static_cast<uint64_t>(1) << bv_sz) - 1;
+        m_mpz_manager.set(incremented, (m_mpz_manager.get_uint64(old_value) + 1) & mask);
+        return;
+    }
     unsigned shift;
     m_mpz_manager.add(old_value, m_one, incremented);
     if (m_mpz_manager.is_power_of_two(incremented, shift) && shift == bv_sz)
@@ -210,6 +224,11 @@ void sls_engine::mk_inc(unsigned bv_sz, const mpz & old_value, mpz & incremented
 }
 
 void sls_engine::mk_dec(unsigned bv_sz, const mpz & old_value, mpz & decremented) {
+    if (bv_sz <= 64) {
+        uint64_t mask = bv_sz == 64 ? UINT64_MAX : (static_cast<uint64_t>(1) << bv_sz) - 1;
+        m_mpz_manager.set(decremented, (m_mpz_manager.get_uint64(old_value) - 1) & mask);
+        return;
+    }
     if (m_mpz_manager.is_zero(old_value)) {
         m_mpz_manager.set(decremented, m_powers(bv_sz));
         m_mpz_manager.dec(decremented);
@@ -219,13 +238,20 @@ void sls_engine::mk_dec(unsigned bv_sz, const mpz & old_value, mpz & decremented
 }
 
 void sls_engine::mk_inv(unsigned bv_sz, const mpz & old_value, mpz & inverted) {
+    if (bv_sz <= 64) {
+        uint64_t mask = bv_sz == 64 ? UINT64_MAX : (static_cast<uint64_t>(1) << bv_sz) - 1;
+        m_mpz_manager.set(inverted, ~m_mpz_manager.get_uint64(old_value) & mask);
+        return;
+    }
     m_mpz_manager.bitwise_not(bv_sz, old_value, inverted);
 }
 
 void sls_engine::mk_flip(sort * s, const mpz & old_value, unsigned bit, mpz & flipped) {
     m_mpz_manager.set(flipped, m_zero);
 
-    if (m_bv_util.is_bv_sort(s)) {
+    if (m_bv_util.is_bv_sort(s) && bit < 64 && m_bv_util.get_bv_size(s) <= 64)
+        m_mpz_manager.set(flipped, m_mpz_manager.get_uint64(old_value) ^ (static_cast<uint64_t>(1) << bit));
+    else if (m_bv_util.is_bv_sort(s)) {
         mpz mask;
         m_mpz_manager.set(mask, m_powers(bit));
         m_mpz_manager.bitwise_xor(old_value, mask, flipped);
@@ -531,6 +557,20 @@ void sls_engine::operator()(goal_ref const & g, model_converter_ref & mc) {
 
     m_produce_models = g->models_enabled();
 
+    if (m_threads > 1) {
+        model_ref mdl;
+        if (parallel(g, mdl) == l_true) {
+            if (m_produce_models) {
+                mc = model2model_converter(mdl.get());
+                TRACE("sls_model", mc->display(tout););
+            }
+            g->reset();
+        }
+        else
+            mc = nullptr;
+        return;
+    }
+
     for (unsigned i = 0; i < g->size(); i++)
         assert_expr(g->form(i));    
 
@@ -579,11 +619,113 @@ lbool sls_engine::operator()() {
         }
     } while (res != l_true && m_stats.m_restarts++ < m_max_restarts);
 
-    verbose_stream() << "(restarts: " << m_stats.m_restarts << " flips: " << m_stats.m_moves << " fps: " << (m_stats.m_moves / m_stats.m_stopwatch.get_current_seconds()) << ")" << std::endl;
+    IF_VERBOSE(1, verbose_stream() << "(restarts: " << m_stats.m_restarts << " flips: " << m_stats.m_moves << " fps: " << (m_stats.m_moves / m_stats.m_stopwatch.get_current_seconds()) << ")" << std::endl;);
     
     return res;
 }
 
+#ifdef SINGLE_THREAD
+
+lbool sls_engine::parallel(goal_ref const & g, model_ref & mdl) {
+    m_threads = 1;
+    for (unsigned i = 0; i < g->size(); i++)
+        assert_expr(g->form(i));
+    lbool res = operator()();
+    if (res == l_true)
+        mdl = m_tracker.get_model();
+    return res;
+}
+
+#else
+
+#include <thread>
+#include <mutex>
+
+/**
+   \brief run independent walkers with different seeds on copies of the goal.
+   Each walker owns an ast_manager, so they share no state. The first walker
+   that satisfies all assertions cancels the others.
+*/
+lbool sls_engine::parallel(goal_ref const & g, model_ref & mdl) {
+    unsigned num_threads = m_threads;
+    scoped_ptr_vector<ast_manager> pms;
+    vector<expr_ref_vector> forms;
+    scoped_ptr_vector<sls_engine> engines;
+    scoped_limits sl(m_manager.limit());
+    sls_params sp(m_params);
+    for (unsigned i = 0; i < num_threads; ++i) {
+        ast_manager* new_m = alloc(ast_manager, m_manager, true);
+        pms.push_back(new_m);
+        params_ref p(m_params);
+        p.set_uint("threads", 1);
+        p.set_uint("random_seed", sp.random_seed() + i);
+        engines.push_back(alloc(sls_engine, *new_m, p));
+        ast_translation tr(m_manager, *new_m);
+        // the engine does not take references to its assertions
+        forms.push_back(expr_ref_vector(*new_m));
+        for (unsigned j = 0; j < g->size(); j++)
+            forms.back().push_back(tr(g->form(j)));
+        for (expr* f : forms.back())
+            engines.back()->assert_expr(f);
+        sl.push_child(&(new_m->limit()));
+    }
+
+    std::mutex mux;
+    unsigned finished_id = UINT_MAX;
+    std::string ex_msg;
+
+    auto worker_thread = [&](unsigned i) {
+        try {
+            lbool r = (*engines[i])();
+            if (r != l_true)
+                return;
+            {
+                std::lock_guard<std::mutex> lock(mux);
+                if (finished_id != UINT_MAX)
+                    return;
+                finished_id = i;
+            }
+            for (ast_manager* m : pms)
+                if (m != pms[i])
+                    m->limit().cancel();
+        }
+        catch (z3_exception & ex) {
+            std::lock_guard<std::mutex> lock(mux);
+            if (ex_msg.empty())
+                ex_msg = ex.msg();
+        }
+        catch (...) {
+            std::lock_guard<std::mutex> lock(mux);
+            if (ex_msg.empty())
+                ex_msg = "unknown exception";
+        }
+    };
+
+    vector<std::thread> threads(num_threads);
+    for (unsigned i = 0; i < num_threads; ++i)
+        threads[i] = std::thread([&, i]() { worker_thread(i); });
+    for (auto & th : threads)
+        th.join();
+
+    for (sls_engine* e : engines)
+        m_stats.add(e->m_stats);
+
+    if (finished_id == UINT_MAX) {
+        if (!m_manager.inc())
+            throw tactic_exception(m_manager.limit().get_cancel_msg());
+        if (!ex_msg.empty())
+            throw default_exception(std::move(ex_msg));
+        return l_undef;
+    }
+
+    IF_VERBOSE(1, verbose_stream() << "(sls :walker " << finished_id << " :threads " << num_threads << ")\n");
+    ast_translation tr(*pms[finished_id], m_manager);
+    mdl = engines[finished_id]->get_model()->translate(tr);
+    return l_true;
+}
+
+#endif
+
 /* Andreas: Needed for Armin's restart scheme if we don't want to use loops.
 double sls_engine::get_restart_armin(unsigned cnt_restarts)
 {
@@ -54,10 +54,21 @@ public:
             m_stopwatch.reset();
             m_stopwatch.start();
         }
+        void add(stats const& st) {
+            m_restarts += st.m_restarts;
+            m_full_evals += st.m_full_evals;
+            m_incr_evals += st.m_incr_evals;
+            m_moves += st.m_moves;
+            m_flips += st.m_flips;
+            m_incs += st.m_incs;
+            m_decs += st.m_decs;
+            m_invs += st.m_invs;
+        }
     };
 
 protected:
     ast_manager   & m_manager;
+    params_ref      m_params;
     stats           m_stats;
     unsynch_mpz_manager m_mpz_manager;
     powers          m_powers;
@@ -82,6 +93,7 @@ protected:
     unsigned        m_early_prune;
     unsigned        m_random_offset;
     unsigned        m_rescore;
+    unsigned        m_threads;
 
     typedef enum { MV_FLIP = 0, MV_INC, MV_DEC, MV_INV } move_type;
 
@@ -111,11 +123,14 @@ public:
     lbool search();
 
     lbool operator()();
+    model_ref get_model() { return m_tracker.get_model(); }
     void operator()(goal_ref const & g, model_converter_ref & mc);
 
 protected:
     void checkpoint();
 
+    lbool parallel(goal_ref const & g, model_ref & mdl);
+
     bool what_if(func_decl * fd, const unsigned & fd_inx, const mpz & temp,
                  double & best_score, unsigned & best_const, mpz & best_value);
 
@@ -36,6 +36,7 @@ class sls_evaluator {
     expr_ref_buffer       m_temp_exprs;
     vector<ptr_vector<expr> > m_traversal_stack;
     vector<ptr_vector<expr> > m_traversal_stack_bool;
+    bool                  m_machine_words = true;
 
 public:
     sls_evaluator(ast_manager & m, bv_util & bvu, sls_tracker & t, unsynch_mpz_manager & mm, powers & p) : 
@@ -57,6 +58,12 @@ public:
         m_mpz_manager.del(m_one);
         m_mpz_manager.del(m_two);            
     }
+
+    /**
+       \brief enable or disable evaluation of narrow bit-vectors on machine words.
+       Disabling it evaluates all bit-vector operations with bignums.
+    */
+    void set_machine_words(bool f) { m_machine_words = f; }
     
     void operator()(app * n, mpz & result) {
         family_id nfid = n->get_family_id();
@@ -131,6 +138,9 @@ public:
                 NOT_IMPLEMENTED_YET();
             }
         }
+        else if (nfid == m_bv_fid && m_machine_words && eval_uint64(n, result)) {
+            // bit-vectors of at most 64 bits are evaluated on machine words
+        }
         else if (nfid == m_bv_fid) {
             bv_op_kind k = static_cast<bv_op_kind>(fd->get_decl_kind());
             switch(k) {
@@ -496,6 +506,116 @@ public:
         SASSERT(m_mpz_manager.is_nonneg(result));
     }
 
+    uint64_t get_uint64(expr * n) {
+        return m_mpz_manager.get_uint64(m_tracker.get_value(n));
+    }
+
+    /**
+       \brief evaluate bit-vector operations whose arguments and result fit into 64 bits
+       without going through bignum arithmetic. Return false if n is not covered.
+    */
+    bool eval_uint64(app * n, mpz & result) {
+        if (!m_bv_util.is_bv(n))
+            return false;
+        unsigned bv_sz = m_bv_util.get_bv_size(n);
+        if (bv_sz > 64)
+            return false;
+        uint64_t mask = bv_sz == 64 ? UINT64_MAX : (static_cast<uint64_t>(1) << bv_sz) - 1;
+        unsigned n_args = n->get_num_args();
+        expr * const * args = n->get_args();
+        uint64_t r = 0;
+        switch (n->get_decl_kind()) {
+        case OP_CONCAT:
+            for (unsigned i = 0; i < n_args; i++) {
+                if (i != 0)
+                    r <<= m_bv_util.get_bv_size(args[i]);
+                r |= get_uint64(args[i]);
+            }
+            break;
+        case OP_EXTRACT:
+            if (m_bv_util.get_bv_size(args[0]) > 64)
+                return false;
+            r = get_uint64(args[0]) >> m_bv_util.get_extract_low(n);
+            break;
+        case OP_SIGN_EXT: {
+            unsigned sz = m_bv_util.get_bv_size(args[0]);
+            r = get_uint64(args[0]);
+            if (sz < 64 && ((r >> (sz - 1)) & 1))
+                r |= ~((static_cast<uint64_t>(1) << sz) - 1);
+            break;
+        }
+        case OP_BADD:
+            for (unsigned i = 0; i < n_args; i++)
+                r += get_uint64(args[i]);
+            break;
+        case OP_BSUB:
+            r = get_uint64(args[0]) - get_uint64(args[1]);
+            break;
+        case OP_BMUL:
+            r = get_uint64(args[0]);
+            for (unsigned i = 1; i < n_args; i++)
+                r *= get_uint64(args[i]);
+            break;
+        case OP_BNEG:
+            r = 0 - get_uint64(args[0]);
+            break;
+        case OP_BUDIV:
+        case OP_BUDIV_I: {
+            uint64_t y = get_uint64(args[1]);
+            r = y == 0 ? mask : get_uint64(args[0]) / y;
+            break;
+        }
+        case OP_BUREM:
+        case OP_BUREM_I: {
+            uint64_t x = get_uint64(args[0]), y = get_uint64(args[1]);
+            r = y == 0 ? x : x % y;
+            break;
+        }
+        case OP_BAND:
+            r = get_uint64(args[0]);
+            for (unsigned i = 1; i < n_args; i++)
+                r &= get_uint64(args[i]);
+            break;
+        case OP_BOR:
+            for (unsigned i = 0; i < n_args; i++)
+                r |= get_uint64(args[i]);
+            break;
+        case OP_BXOR:
+            for (unsigned i = 0; i < n_args; i++)
+                r ^= get_uint64(args[i]);
+            break;
+        case OP_BNOT:
+            r = ~get_uint64(args[0]);
+            break;
+        case OP_BSHL: {
+            uint64_t y = get_uint64(args[1]);
+            r = y >= bv_sz ? 0 : get_uint64(args[0]) << y;
+            break;
+        }
+        case OP_BLSHR: {
+            uint64_t y = get_uint64(args[1]);
+            r = y >= bv_sz ? 0 : get_uint64(args[0]) >> y;
+            break;
+        }
+        case OP_BASHR: {
+            uint64_t x = get_uint64(args[0]), y = get_uint64(args[1]);
+            bool sign = (x >> (bv_sz - 1)) & 1;
+            if (y >= bv_sz)
+                r = sign ? mask : 0;
+            else {
+                r = x >> y;
+                if (sign && y > 0)
+                    r |= mask << (bv_sz - y);
+            }
+            break;
+        }
+        default:
+            return false;
+        }
+        m_mpz_manager.set(result, r & mask);
+        return true;
+    }
+
     void eval_checked(expr * n, mpz & result) {
         switch(n->get_kind()) {
         case AST_APP: {
@@ -0,0 +1,137 @@
+/*++
+Copyright (c) 2023 Microsoft Corporation
+
+Module Name:
+
+    dary_heap.cpp
+
+Abstract:
+
+    Test d-ary heap template against the binary heap.
+
+Revision History:
+
+--*/
+#include "util/util.h"
+#include "util/heap.h"
+#include "util/dary_heap.h"
+#include "util/trace.h"
+
+#define N 1000
+
+static random_gen dheap_rand(1);
+static int g_dvalue[N];
+
+// keys are unique so that all heaps remove the same element at each step.
+static int mk_dvalue(unsigned r, int i) { return static_cast<int>(r % (INT_MAX / N)) * N + i; }
+
+struct dheap_lt { bool operator()(int v1, int v2) const { return g_dvalue[v1] < g_dvalue[v2]; } };
+
+template<typename H>
+static void run_ops(H & h, unsigned seed, unsigned num_ops, int_vector & trace) {
+    random_gen r(seed);
+    for (unsigned i = 0; i < num_ops; i++) {
+        int cmd = r() % 10;
+        int val = r() % N;
+        if (cmd <= 3) {
+            if (!h.contains(val))
+                h.insert(val);
+        }
+        else if (cmd <= 5) {
+            if (h.contains(val))
+                h.erase(val);
+        }
+        else if (cmd <= 7) {
+            if (h.contains(val)) {
+                int old_v = g_dvalue[val];
+                g_dvalue[val] = mk_dvalue(r(), val);
+                if (old_v < g_dvalue[val])
+                    h.increased(val);
+                else
+                    h.decreased(val);
+            }
+        }
+        else if (!h.empty()) {
+            trace.push_back(g_dvalue[h.erase_min()]);
+        }
+    }
+    while (!h.empty())
+        trace.push_back(g_dvalue[h.erase_min()]);
+}
+
+static void init_dvalues() {
+    for (unsigned i = 0; i < N; i++)
+        g_dvalue[i] = mk_dvalue(dheap_rand(), i);
+}
+
+template<typename H>
+static void check(unsigned seed, int_vector & trace) {
+    init_dvalues();
+    H h(N);
+    run_ops(h, seed, 20 * N, trace);
+    ENSURE(h.check_invariant());
+}
+
+// activity-ordered workload of the case split queue: bump a few variables
+// per conflict, then pop and re-insert decisions. Ties between activities are
+// broken differently by the heaps, so only the popped activities are compared.
+#define NUM_ACT_VARS 200
+
+static double g_activity[NUM_ACT_VARS];
+
+struct act_lt { bool operator()(int v1, int v2) const { return g_activity[v1] > g_activity[v2]; } };
+
+template<typename H>
+static void run_activity(unsigned num_conflicts, svector<double> & trace) {
+    random_gen r(0);
+    for (unsigned i = 0; i < NUM_ACT_VARS; i++)
+        g_activity[i] = 0;
+    H h(NUM_ACT_VARS);
+    for (int v = 0; v < NUM_ACT_VARS; v++)
+        h.insert(v);
+    int_vector decided;
+    double inc = 1.0;
+    for (unsigned k = 0; k < num_conflicts; k++) {
+        for (unsigned j = 0; j < 20; j++) {
+            int v = r() % NUM_ACT_VARS;
+            g_activity[v] += inc;
+            if (h.contains(v))
+                h.decreased(v);
+        }
+        inc *= 1.05;
+        if (inc > 1e100) {
+            for (unsigned i = 0; i < NUM_ACT_VARS; i++)
+                g_activity[i] *= 1e-100;
+            inc *= 1e-100;
+        }
+        for (unsigned j = 0; j < 10; j++) {
+            int v = h.erase_min();
+            trace.push_back(g_activity[v]);
+            decided.push_back(v);
+        }
+        for (int v : decided)
+            h.insert(v);
+        decided.reset();
+    }
+    ENSURE(h.check_invariant());
+}
+
+void tst_dary_heap() {
+    for (unsigned i = 0; i < 3; ++i) {
+        int_vector t1, t2, t3;
+        dheap_rand.set_seed(i);
+        check<heap<dheap_lt>>(i, t1);
+        dheap_rand.set_seed(i);
+        check<dary_heap<dheap_lt, 4>>(i, t2);
+        dheap_rand.set_seed(i);
+        check<dary_heap<dheap_lt, 8>>(i, t3);
+        ENSURE(t1 == t2);
+        ENSURE(t1 == t3);
+    }
+    svector<double> a1, a2, a3;
+    run_activity<heap<act_lt>>(500, a1);
+    run_activity<dary_heap<act_lt, 4>>(500, a2);
+    run_activity<dary_heap<act_lt, 8>>(500, a3);
+    ENSURE(a1 == a2);
+    ENSURE(a1 == a3);
+}
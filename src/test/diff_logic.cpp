@@ -16,10 +16,10 @@ Author:
 Revision History:
 
 --*/
-#ifdef _WINDOWS
 #include "util/rational.h"
 #include "smt/diff_logic.h"
 #include "smt/smt_literal.h"
+#ifdef _WINDOWS
 #include "util/util.h"
 #include "util/debug.h"
 #include <iostream>
@@ -173,3 +173,60 @@ void tst_diff_logic() {
 void tst_diff_logic() {
 }
 #endif
+
+namespace {
+    struct implied_ext {
+        typedef rational numeral;
+        typedef smt::literal explanation;
+    };
+
+    struct collect_literals {
+        smt::literal_vector m_literals;
+        void operator()(smt::literal l) { m_literals.push_back(l); }
+    };
+}
+
+typedef dl_graph<implied_ext> implied_graph;
+
+static bool same_literals(smt::literal_vector lits, std::initializer_list<unsigned> expected) {
+    if (lits.size() != expected.size())
+        return false;
+    for (unsigned v : expected)
+        if (!lits.contains(smt::literal(v)))
+            return false;
+    return true;
+}
+
+// Edges implied by a path of at most two edges through a newly enabled edge,
+// as used by arith.dl_implied_edges, and the paths that explain them.
+void tst_diff_logic_implied_edges() {
+    implied_graph g;
+    for (dl_var v = 0; v < 4; ++v)
+        g.init_var(v);
+    ENSURE(g.enable_edge(g.add_edge(0, 1, rational(1), smt::literal(1))));
+    ENSURE(g.enable_edge(g.add_edge(2, 3, rational(1), smt::literal(2))));
+    edge_id e12 = g.add_edge(1, 2, rational(4), smt::literal(8));
+    edge_id e02 = g.add_edge(0, 2, rational(2), smt::literal(7));
+    edge_id e13 = g.add_edge(1, 3, rational(3), smt::literal(6));
+    edge_id e03 = g.add_edge(0, 3, rational(5), smt::literal(5));
+    edge_id e02_tight = g.add_edge(0, 2, rational(1), smt::literal(9));
+    edge_id bridge = g.add_edge(1, 2, rational(1), smt::literal(3));
+    ENSURE(g.enable_edge(bridge));
+
+    svector<edge_id> implied;
+    g.find_subsumed2(bridge, implied);
+    ENSURE(implied.contains(e12));
+    ENSURE(implied.contains(e02));
+    ENSURE(implied.contains(e13));
+    // 0 -> 3 needs a path of three edges, and 0 -> 2 with weight 1 does not follow
+    ENSURE(!implied.contains(e03));
+    ENSURE(!implied.contains(e02_tight));
+
+    collect_literals f12, f02, f13;
+    g.explain_subsumed_lazy(bridge, e12, f12);
+    g.explain_subsumed_lazy(bridge, e02, f02);
+    g.explain_subsumed_lazy(bridge, e13, f13);
+    ENSURE(same_literals(f12.m_literals, { 3 }));
+    ENSURE(same_literals(f02.m_literals, { 1, 3 }));
+    ENSURE(same_literals(f13.m_literals, { 3, 2 }));
+}
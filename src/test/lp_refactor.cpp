@@ -0,0 +1,56 @@
+/*++
+Copyright (c) 2023 Microsoft Corporation
+
+Module Name:
+
+    lp_refactor.cpp
+
+Abstract:
+
+    Solve a linear program with the LU-based primal simplex of the lp
+    frontend, once refactoring after every pivot and once with the default
+    refactorization interval.
+
+Revision History:
+
+--*/
+#include "util/util.h"
+#include "math/lp/lp_primal_simplex.h"
+
+using namespace lp;
+
+// maximize sum c_j x_j subject to sum a_ij x_j <= b_i and 0 <= x_j <= 10.
+static void mk_lp(lp_primal_simplex<double, double> & s, unsigned rows, unsigned cols) {
+    random_gen r(7);
+    for (unsigned i = 0; i < rows; ++i) {
+        for (unsigned j = 0; j < cols; ++j)
+            if (r() % 3 == 0)
+                s.set_row_column_coefficient(i, j, 1 + r() % 9);
+        s.add_constraint(Less_or_equal, 50 + r() % 50, i);
+    }
+    for (unsigned j = 0; j < cols; ++j) {
+        s.set_cost_for_column(j, 1 + r() % 5);
+        s.set_lower_bound(j, 0);
+        s.set_upper_bound(j, 10);
+    }
+}
+
+static double solve_lp(unsigned refactor_interval, lp::statistics & st) {
+    lp_primal_simplex<double, double> s;
+    mk_lp(s, 30, 40);
+    s.settings().simplex_strategy() = simplex_strategy_enum::lu;
+    s.settings().refactor_interval = refactor_interval;
+    s.find_maximal_solution();
+    ENSURE(s.get_status() == lp_status::OPTIMAL);
+    st = s.settings().stats();
+    return s.get_current_cost();
+}
+
+void tst_lp_refactor() {
+    lp::statistics st_every, st_default;
+    double cost_every   = solve_lp(1, st_every);
+    double cost_default = solve_lp(200, st_default);
+    ENSURE(std::abs(cost_every - cost_default) < 1e-6 * (1 + std::abs(cost_default)));
+    ENSURE(st_default.m_num_lu_updates > 0);
+    ENSURE(st_every.m_num_factorizations > st_default.m_num_factorizations);
+}
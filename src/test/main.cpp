@@ -152,6 +152,7 @@ int main(int argc, char ** argv) {
     TST(region);
     TST(symbol);
     TST(heap);
+    TST(dary_heap);
     TST(hashtable);
     TST(rational);
     TST(inf_rational);
@@ -165,6 +166,7 @@ int main(int argc, char ** argv) {
     TST(string_buffer);
     TST(map);
     TST(diff_logic);
+    TST(diff_logic_implied_edges);
     TST(uint_set);
     TST_ARGV(expr_rand);
     TST(list);
@@ -172,6 +174,7 @@ int main(int argc, char ** argv) {
     TST(timeout);
     TST(proof_checker);
     TST(simplifier);
+    TST(sls_evaluator);
     TST(bit_blaster);
     TST(var_subst);
     TST(simple_parser);
@@ -203,6 +206,9 @@ int main(int argc, char ** argv) {
     TST(arith_rewriter);
     TST(check_assumptions);
     TST(smt_context);
+    TST(smt_context_scored_case_split);
+    TST(smt_context_local_search);
+    TST(smt_options);
     TST(theory_dl);
     TST(model_retrieval);
     TST(model_based_opt);
@@ -210,12 +216,17 @@ int main(int argc, char ** argv) {
     TST(smt2print_parse);
     TST(substitution);
     TST(polynomial);
+    TST(polynomial_psc_cache);
     TST(upolynomial);
     TST(algebraic);
     TST(prime_generator);
     TST(permutation);
     TST(nlsat);
     TST(zstring);
+    TST(seq_rewriter);
+    TST(special_relations);
+    TST(theory_str);
+    TST(lp_refactor);
     if (test_all) return 0;
     TST(ext_numeral);
     TST(interval);
@@ -246,6 +257,7 @@ int main(int argc, char ** argv) {
     TST(expr_substitution);
     TST(sorting_network);
     TST(theory_pb);
+    TST(theory_pb_large_coeffs);
     TST(simplex);
     TST(sat_user_scope);
     TST_ARGV(ddnf);
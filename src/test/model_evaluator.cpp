@@ -2,10 +2,83 @@
 #include "model/model_evaluator.h"
 #include "model/model_pp.h"
 #include "ast/arith_decl_plugin.h"
+#include "ast/array_decl_plugin.h"
 #include "ast/reg_decl_plugins.h"
 #include "ast/ast_pp.h"
 #include <iostream>
 
+static void tst_incremental() {
+    ast_manager m;
+    reg_decl_plugins(m);
+    arith_util a(m);
+    model mdl(m);
+
+    func_decl_ref x(m.mk_const_decl("x", a.mk_int()), m);
+    func_decl_ref y(m.mk_const_decl("y", a.mk_int()), m);
+    expr_ref X(m.mk_const(x), m), Y(m.mk_const(y), m);
+    mdl.register_decl(x, a.mk_int(1));
+    mdl.register_decl(y, a.mk_int(1));
+
+    expr_ref f1(a.mk_gt(a.mk_add(X, Y), a.mk_int(3)), m);
+    expr_ref f2(a.mk_lt(X, a.mk_int(2)), m);
+    expr_ref f3(m.mk_eq(Y, a.mk_int(1)), m);
+
+    model_evaluator eval(mdl);
+    eval.track(f1);
+    eval.track(f2);
+    eval.track(f3);
+    ENSURE(m.is_false(eval.get_tracked_value(f1)));
+    ENSURE(m.is_true(eval.get_tracked_value(f2)));
+    ENSURE(m.is_true(eval.get_tracked_value(f3)));
+
+    ptr_vector<expr> changed;
+    mdl.register_decl(x, a.mk_int(3));
+    func_decl* decls[1] = { x.get() };
+    eval.update(1, decls, changed);
+    ENSURE(changed.size() == 2);
+    ENSURE(changed.contains(f1) && changed.contains(f2));
+    ENSURE(m.is_true(eval.get_tracked_value(f1)));
+    ENSURE(m.is_false(eval.get_tracked_value(f2)));
+    ENSURE(m.is_true(eval.get_tracked_value(f3)));
+
+    changed.reset();
+    mdl.register_decl(x, a.mk_int(4));
+    eval.update(1, decls, changed);
+    ENSURE(changed.empty());
+}
+
+static void tst_incremental_as_array(bool completion) {
+    ast_manager m;
+    reg_decl_plugins(m);
+    arith_util a(m);
+    array_util ar(m);
+    model mdl(m);
+
+    sort* sI = a.mk_int();
+    func_decl_ref f(m.mk_func_decl(symbol("f"), 1, &sI, sI), m);
+    func_interp* fi = alloc(func_interp, m, 1);
+    fi->set_else(a.mk_int(1));
+    mdl.register_decl(f, fi);
+
+    expr_ref F(ar.mk_as_array(f), m);
+    expr* args[2] = { F.get(), a.mk_int(0) };
+    expr_ref f1(m.mk_eq(ar.mk_select(2, args), a.mk_int(1)), m);
+
+    model_evaluator eval(mdl);
+    eval.set_model_completion(completion);
+    eval.track(f1);
+    ENSURE(m.is_true(eval.get_tracked_value(f1)));
+
+    ptr_vector<expr> changed;
+    fi = alloc(func_interp, m, 1);
+    fi->set_else(a.mk_int(2));
+    mdl.register_decl(f, fi);
+    func_decl* decls[1] = { f.get() };
+    eval.update(1, decls, changed);
+    ENSURE(changed.size() == 1 && changed[0] == f1);
+    ENSURE(m.is_false(eval.get_tracked_value(f1)));
+}
+
 void tst_model_evaluator() {
     ast_manager m;
     reg_decl_plugins(m);
@@ -65,5 +138,8 @@ void tst_model_evaluator() {
         eval(e, v);
         std::cout << e << " " << v << "\n";
     }
-    
+
+    tst_incremental();
+    tst_incremental_as_array(false);
+    tst_incremental_as_array(true);
 }
@@ -146,6 +146,46 @@ public:
     }
 
 
+    static void gc_and_values() {
+        std::cout << "\ngc and values\n";
+        pdd_manager m(3);
+        {
+            pdd a = m.mk_var(0);
+            pdd b = m.mk_var(1);
+            pdd c = m.mk_var(2);
+            // values inside and outside of the range of directly mapped small values
+            for (int v : { -1025, -1024, -1023, -1, 0, 1, 2, 1023, 1024, 1025, 100000 }) {
+                pdd p = m.mk_val(rational(v));
+                VERIFY(p.is_val() && p.val() == rational(v));
+                VERIFY(p == m.mk_val(rational(v)));
+                VERIFY((a + v) - a == p);
+                VERIFY((a + v) * (b - v) == a * b - v * a + v * b - rational(v) * rational(v));
+            }
+            pdd keep = (a + 3) * (b - 1024) * (c + 1025);
+            unsigned idx = keep.index();
+            for (int i = 0; i < 200; ++i) {
+                pdd t = (a + i) * (b + 2 * i) * (c - i);
+                VERIFY(!t.is_val());
+            }
+            m.gc();
+            VERIFY(keep.index() == idx);
+            VERIFY(keep == (a + 3) * (b - 1024) * (c + 1025));
+            // collected nodes are rebuilt in canonical form
+            for (int i = 0; i < 200; ++i) {
+                pdd t1 = (a + i) * (b + 2 * i) * (c - i);
+                pdd t2 = (c - i) * (a + i) * (b + 2 * i);
+                VERIFY(t1 == t2);
+            }
+        }
+        unsigned_vector l2v;
+        for (unsigned i = 0; i < 3; ++i)
+            l2v.push_back(2 - i);
+        m.reset(l2v);
+        pdd a = m.mk_var(0);
+        VERIFY((a + 1024) * (a - 1024) == a * a - 1048576);
+        VERIFY(m.mk_val(rational(-1024)) + 2048 == m.mk_val(rational(1024)));
+    }
+
     static void iterator() {
         std::cout << "test iterator\n";
         pdd_manager m(4);
@@ -660,6 +700,7 @@ void tst_pdd() {
     dd::test::large_product();
     dd::test::canonize();
     dd::test::reset();
+    dd::test::gc_and_values();
     dd::test::iterator();
     dd::test::order();
     dd::test::order_lm();
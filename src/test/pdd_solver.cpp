@@ -253,9 +253,55 @@ namespace dd {
         test_simplify(fmls, false);
         
     }
+
+    static bool has_conflict(solver& g) {
+        for (solver::equation* e : g.equations())
+            if (e->poly().is_val() && !e->poly().is_zero())
+                return true;
+        return false;
+    }
+
+    /**
+       saturation on shards has to use the semantics of the solver:
+       the same equations over GF(2) are saturated sequentially and on shards.
+    */
+    void test3() {
+        for (unsigned num_threads : { 1, 3 }) {
+            pdd_manager m(4, pdd_manager::mod2_e);
+            reslimit lim;
+            pdd x = m.mk_var(0);
+            pdd y = m.mk_var(1);
+            pdd z = m.mk_var(2);
+            pdd u = m.mk_var(3);
+            solver gb(lim, m);
+            solver::config cfg;
+            cfg.m_num_threads = num_threads;
+            gb.set(cfg);
+
+            // x*y = 1 forces y = 1, z*(y + 1) = 1 forces y = 0
+            for (pdd const& v : { x, y, z, u })
+                gb.add(v*v + v);
+            gb.add(x*y + 1);
+            gb.add(z*y + z + 1);
+            gb.add(x*u + z*u + y);
+            gb.saturate();
+            ENSURE(has_conflict(gb));
+            gb.reset();
+
+            // x = y = 1, z = 0 is a solution
+            for (pdd const& v : { x, y, z, u })
+                gb.add(v*v + v);
+            gb.add(x*y + 1);
+            gb.add(z*y + z);
+            gb.add(x*u + z*u + u + z);
+            gb.saturate();
+            ENSURE(!has_conflict(gb));
+        }
+    }
 }
 
 void tst_pdd_solver() {
     dd::test1();
     dd::test2();
+    dd::test3();
 }
@@ -23,6 +23,7 @@ Notes:
 #include "math/polynomial/linear_eq_solver.h"
 #include "util/rlimit.h"
 #include <iostream>
+#include <cstring>
 
 static void tst1() {
     std::cout << "\n----- Basic testing -------\n";
@@ -1463,6 +1464,50 @@ static void tst_del_eh() {
     ENSURE(eh2.m_counter == 3);
 }
 
+static unsigned get_stat(polynomial::cache const & c, char const * key) {
+    statistics st;
+    c.collect_statistics(st);
+    for (unsigned i = 0; i < st.size(); i++)
+        if (st.is_uint(i) && strcmp(st.get_key(i), key) == 0)
+            return st.get_uint_value(i);
+    return 0;
+}
+
+void tst_polynomial_psc_cache() {
+    reslimit rl;
+    polynomial::numeral_manager nm;
+    polynomial::manager m(rl, nm);
+    polynomial_ref x(m), y(m);
+    x = m.mk_polynomial(m.mk_var());
+    y = m.mk_polynomial(m.mk_var());
+    polynomial::cache c(m);
+    c.set_max_psc_entries(4);
+    polynomial_ref p(m), q(m);
+    polynomial_ref_vector S(m), T(m);
+    // revisit earlier pairs after they have been evicted
+    for (unsigned round = 0; round < 2; round++) {
+        for (int i = 1; i <= 20; i++) {
+            p = (x^2) + i*x*y + 1;
+            q = x*y - i;
+            c.psc_chain(p, q, 0, S);
+            m.psc_chain(p, q, 0, T);
+            ENSURE(S.size() == T.size());
+            for (unsigned j = 0; j < S.size(); j++)
+                ENSURE(m.eq(S.get(j), T.get(j)));
+        }
+    }
+    ENSURE(get_stat(c, "polynomial psc cache evictions") > 0);
+    ENSURE(get_stat(c, "polynomial psc cache released") > 0);
+    // a polynomial referenced outside of the cache keeps its unique representative
+    p = c.mk_unique(p);
+    for (int i = 21; i <= 40; i++) {
+        q = x*y - i;
+        c.psc_chain(p, q, 0, S);
+    }
+    q = (x^2) + 20*x*y + 1;
+    ENSURE(c.mk_unique(q) == p.get());
+}
+
 static void tst_const_coeff() {
     polynomial::numeral_manager nm;
     reslimit rl; polynomial::manager m(rl, nm);
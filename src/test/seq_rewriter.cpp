@@ -0,0 +1,58 @@
+/*++
+Copyright (c) 2023 Microsoft Corporation
+
+Module Name:
+
+    seq_rewriter.cpp
+
+Abstract:
+
+    Test the two-generation cache of sequence operations in seq_rewriter.
+
+Revision History:
+
+--*/
+#include <cstring>
+#include "ast/reg_decl_plugins.h"
+#include "ast/rewriter/seq_rewriter.h"
+
+static unsigned get_stat(statistics const& st, char const* key) {
+    for (unsigned i = 0; i < st.size(); ++i)
+        if (st.is_uint(i) && strcmp(st.get_key(i), key) == 0)
+            return st.get_uint_value(i);
+    return 0;
+}
+
+void tst_seq_rewriter() {
+    ast_manager m;
+    reg_decl_plugins(m);
+    seq_util u(m);
+    params_ref p;
+    p.set_uint("op_cache_size", 4);
+    seq_rewriter rw(m);
+    rw.updt_params(p);
+    expr_ref_vector res(m);
+    for (unsigned i = 0; i < 40; ++i) {
+        zstring s(std::to_string(i).c_str());
+        res.push_back(u.re.mk_concat(u.re.mk_to_re(u.str.mk_string(s)), u.re.mk_star(u.re.mk_to_re(u.str.mk_string(zstring("a"))))));
+    }
+    expr_ref hot(u.re.mk_star(u.re.mk_to_re(u.str.mk_string(zstring("b")))), m);
+    expr_ref hot_nullable = rw.is_nullable(hot);
+    // the hot regex is used between all others, so it keeps moving to the current generation
+    for (unsigned round = 0; round < 2; ++round) {
+        for (expr * r : res) {
+            rw.is_nullable(r);
+            ENSURE(rw.is_nullable(hot) == hot_nullable);
+        }
+    }
+    statistics st;
+    rw.collect_statistics(st);
+    unsigned hits = get_stat(st, "seq op cache hits");
+    unsigned misses = get_stat(st, "seq op cache misses");
+    unsigned evictions = get_stat(st, "seq op cache evictions");
+    ENSURE(hits >= 2 * res.size());
+    ENSURE(evictions > 0);
+    // every miss creates one entry, which is either evicted once or still in one of the two generations
+    ENSURE(evictions <= misses);
+    ENSURE(misses - evictions <= 2 * 4);
+}
@@ -0,0 +1,144 @@
+/*++
+Copyright (c) 2023 Microsoft Corporation
+
+Module Name:
+
+    sls_evaluator.cpp
+
+Abstract:
+
+    Cross-check evaluation of narrow bit-vectors on machine words
+    against the bignum evaluation of the SLS evaluator, and run
+    parallel SLS walkers.
+
+Revision History:
+
+--*/
+#include "ast/reg_decl_plugins.h"
+#include "ast/bv_decl_plugin.h"
+#include "ast/ast_pp.h"
+#include "model/model.h"
+#include "tactic/goal.h"
+#include "tactic/sls/sls_engine.h"
+#include "tactic/sls/sls_evaluator.h"
+#include <iostream>
+
+static void tst_machine_words(unsigned bv_sz, uint64_t const* xs, unsigned num_xs, uint64_t const* ys, unsigned num_ys) {
+    ast_manager m;
+    reg_decl_plugins(m);
+    bv_util bv(m);
+    unsynch_mpz_manager mm;
+    powers pw(mm);
+    sls_tracker tracker(m, bv, mm, pw);
+    sls_evaluator ev(m, bv, tracker, mm, pw);
+    app_ref x(m.mk_const(symbol("x"), bv.mk_sort(bv_sz)), m);
+    app_ref y(m.mk_const(symbol("y"), bv.mk_sort(bv_sz)), m);
+    app_ref_vector terms(m);
+    terms.push_back(bv.mk_bv_udiv(x, y));
+    terms.push_back(bv.mk_bv_udiv_i(x, y));
+    terms.push_back(bv.mk_bv_urem(x, y));
+    terms.push_back(bv.mk_bv_urem_i(x, y));
+    terms.push_back(bv.mk_bv_shl(x, y));
+    terms.push_back(bv.mk_bv_lshr(x, y));
+    terms.push_back(bv.mk_bv_ashr(x, y));
+    tracker.initialize(x);
+    tracker.initialize(y);
+    for (app* t : terms)
+        tracker.initialize(t);
+
+    mpz vx, vy, r1, r2;
+    for (unsigned i = 0; i < num_xs; ++i) {
+        for (unsigned j = 0; j < num_ys; ++j) {
+            mm.set(vx, xs[i]);
+            mm.set(vy, ys[j]);
+            tracker.set_value(x, vx);
+            tracker.set_value(y, vy);
+            for (app* t : terms) {
+                ev.set_machine_words(true);
+                ev(t, r1);
+                ev.set_machine_words(false);
+                ev(t, r2);
+                if (!mm.eq(r1, r2))
+                    std::cout << mk_pp(t, m) << " x: " << xs[i] << " y: " << ys[j]
+                              << " words: " << mm.to_string(r1) << " bignum: " << mm.to_string(r2) << "\n";
+                ENSURE(mm.eq(r1, r2));
+            }
+        }
+    }
+    mm.del(vx);
+    mm.del(vy);
+    mm.del(r1);
+    mm.del(r2);
+}
+
+static void tst_sign_extend() {
+    ast_manager m;
+    reg_decl_plugins(m);
+    bv_util bv(m);
+    unsynch_mpz_manager mm;
+    powers pw(mm);
+    sls_tracker tracker(m, bv, mm, pw);
+    sls_evaluator ev(m, bv, tracker, mm, pw);
+    app_ref x8(m.mk_const(symbol("x8"), bv.mk_sort(8)), m);
+    app_ref x64(m.mk_const(symbol("x64"), bv.mk_sort(64)), m);
+    app_ref ext8(bv.mk_sign_extend(8, x8), m);
+    app_ref ext64(bv.mk_sign_extend(0, x64), m);
+    tracker.initialize(x8);
+    tracker.initialize(x64);
+    tracker.initialize(ext8);
+    tracker.initialize(ext64);
+
+    mpz v, r;
+    mm.set(v, 0x85);
+    tracker.set_value(x8, v);
+    ev(ext8, r);
+    ENSURE(mm.get_uint64(r) == 0xff85);
+    mm.set(v, 0x75);
+    tracker.set_value(x8, v);
+    ev(ext8, r);
+    ENSURE(mm.get_uint64(r) == 0x75);
+    mm.set(v, static_cast<uint64_t>(0x8000000000000001ull));
+    tracker.set_value(x64, v);
+    ev(ext64, r);
+    ENSURE(mm.get_uint64(r) == 0x8000000000000001ull);
+    mm.del(v);
+    mm.del(r);
+}
+
+static void tst_parallel() {
+    ast_manager m;
+    reg_decl_plugins(m);
+    bv_util bv(m);
+    expr_ref x(m.mk_const(symbol("x"), bv.mk_sort(16)), m);
+    expr_ref y(m.mk_const(symbol("y"), bv.mk_sort(16)), m);
+    expr_ref_vector fmls(m);
+    fmls.push_back(m.mk_eq(bv.mk_bv_add(x, y), bv.mk_numeral(0x1234, 16)));
+    fmls.push_back(m.mk_eq(bv.mk_bv_and(x, bv.mk_numeral(0xff, 16)), bv.mk_numeral(0x34, 16)));
+    fmls.push_back(m.mk_not(m.mk_eq(y, bv.mk_numeral(0, 16))));
+
+    goal_ref g = alloc(goal, m, true);
+    for (expr* f : fmls)
+        g->assert_expr(f);
+    params_ref p;
+    p.set_uint("threads", 2);
+    sls_engine engine(m, p);
+    model_converter_ref mc;
+    engine(g, mc);
+    ENSURE(g->size() == 0);
+    ENSURE(mc);
+    model_ref mdl = alloc(model, m);
+    (*mc)(mdl);
+    for (expr* f : fmls)
+        ENSURE(mdl->is_true(f));
+}
+
+void tst_sls_evaluator() {
+    uint64_t vals8[] = { 0, 1, 2, 3, 7, 8, 9, 37, 0x5a, 0x7f, 0x80, 0x81, 0xc3, 0xfe, 0xff };
+    unsigned n8 = sizeof(vals8) / sizeof(vals8[0]);
+    tst_machine_words(8, vals8, n8, vals8, n8);
+    uint64_t vals64[] = { 0, 1, 2, 63, 64, 65, 200, 0x123456789abcdefull, 0x8000000000000000ull, 0xfffffffffffffffeull, 0xffffffffffffffffull };
+    // the bignum evaluator shifts one bit at a time, so keep the shift amounts small
+    tst_machine_words(64, vals64, sizeof(vals64) / sizeof(vals64[0]), vals64, 7);
+    tst_sign_extend();
+    tst_parallel();
+}
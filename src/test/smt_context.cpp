@@ -4,8 +4,10 @@ Copyright (c) 2015 Microsoft Corporation
 
 --*/
 
+#include <cstring>
 #include "smt/smt_context.h"
 #include "ast/reg_decl_plugins.h"
+#include "ast/bv_decl_plugin.h"
 
 void tst_smt_context()
 {
@@ -35,3 +37,96 @@ void tst_smt_context()
 
     ctx.check();
 }
+
+namespace {
+    // decide the atom named m_name first, and to false.
+    class prefer_atom_scorer : public smt::case_split_scorer {
+        symbol     m_name;
+        unsigned & m_num_calls;
+        bool is_preferred(expr * atom) const { return is_app(atom) && to_app(atom)->get_decl()->get_name() == m_name; }
+    public:
+        prefer_atom_scorer(symbol const & name, unsigned & num_calls): m_name(name), m_num_calls(num_calls) {}
+        double priority(smt::bool_var v, expr * atom) override {
+            ++m_num_calls;
+            return is_preferred(atom) ? 1.0 : 0.0;
+        }
+        lbool phase(smt::bool_var v, expr * atom) override {
+            return is_preferred(atom) ? l_false : l_undef;
+        }
+    };
+}
+
+static void check_scored_case_split(smt_params & params) {
+    // random splits would bypass the scorer
+    params.m_random_var_freq = 0;
+    ast_manager m;
+    reg_decl_plugins(m);
+    smt::context ctx(m, params);
+    unsigned num_calls = 0;
+    ctx.set_case_split_scorer(alloc(prefer_atom_scorer, symbol("c"), num_calls));
+
+    app_ref a(m.mk_const(symbol("a"), m.mk_bool_sort()), m);
+    app_ref b(m.mk_const(symbol("b"), m.mk_bool_sort()), m);
+    app_ref c(m.mk_const(symbol("c"), m.mk_bool_sort()), m);
+    ctx.assert_expr(m.mk_or(a, c));
+    ctx.assert_expr(m.mk_or(b, c));
+    ENSURE(ctx.check() == l_true);
+    ENSURE(num_calls > 0);
+    ENSURE(ctx.get_assignment(c.get()) == l_false);
+}
+
+void tst_smt_context_scored_case_split() {
+    smt_params params;
+    params.m_case_split_strategy = CS_ACTIVITY_SCORED;
+    check_scored_case_split(params);
+    // the default queue is replaced by a scored queue
+    smt_params default_params;
+    check_scored_case_split(default_params);
+}
+
+static unsigned get_stat(smt::context & ctx, char const * key) {
+    statistics st;
+    ctx.collect_statistics(st);
+    for (unsigned i = 0; i < st.size(); ++i)
+        if (st.is_uint(i) && strcmp(st.get_key(i), key) == 0)
+            return st.get_uint_value(i);
+    return 0;
+}
+
+/**
+   \brief check x * x = c over 8 bits, running local search at every restart.
+   Odd squares are 1 modulo 8, so c = 3 has no solution.
+*/
+static void check_local_search(unsigned c, lbool expected) {
+    smt_params params;
+    params.m_local_search = true;
+    params.m_local_search_restarts = 1;
+    params.m_restart_strategy = RS_FIXED;
+    params.m_restart_initial = 1;
+    ast_manager m;
+    reg_decl_plugins(m);
+    bv_util bv(m);
+    smt::context ctx(m, params);
+    app_ref x(m.mk_const(symbol("x"), bv.mk_sort(8)), m);
+    expr_ref_vector fmls(m);
+    fmls.push_back(m.mk_eq(bv.mk_bv_mul(x, x), bv.mk_numeral(c, 8)));
+    fmls.push_back(bv.mk_ule(bv.mk_numeral(0x80, 8), x));
+    for (expr * f : fmls)
+        ctx.assert_expr(f);
+    ENSURE(ctx.check() == expected);
+    ENSURE(get_stat(ctx, "local search calls") > 0);
+    if (expected == l_true) {
+        ENSURE(get_stat(ctx, "local search models") > 0);
+        model_ref mdl;
+        ctx.get_model(mdl);
+        for (expr * f : fmls)
+            ENSURE(mdl->is_true(f));
+    }
+    else
+        ENSURE(get_stat(ctx, "local search models") == 0);
+}
+
+void tst_smt_context_local_search() {
+    check_local_search(0x31, l_true);
+    check_local_search(0x03, l_false);
+}
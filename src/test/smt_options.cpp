@@ -0,0 +1,414 @@
+/*++
+Copyright (c) 2023 Microsoft Corporation
+
+Module Name:
+
+    smt_options.cpp
+
+Abstract:
+
+    Solve small benchmarks with a search option turned off and on.
+    Both runs must give the expected answer, satisfying models must
+    validate against the assertions, and the statistics of the feature
+    controlled by the option must show that it was used.
+    Caches of the solver that have no option are checked the same way
+    through the statistics they report.
+
+Revision History:
+
+--*/
+#include <cstring>
+#include <sstream>
+#include "ast/reg_decl_plugins.h"
+#include "model/model.h"
+#include "cmd_context/cmd_context.h"
+#include "parsers/smt2/smt2parser.h"
+#include "smt/smt_kernel.h"
+#include "smt/params/smt_params.h"
+
+struct option_bench {
+    char const* m_bench;
+    lbool       m_status;
+};
+
+static lbool check_with(char const* bench, params_ref const& p, statistics& st) {
+    ast_manager m;
+    reg_decl_plugins(m);
+    cmd_context ctx(false, &m);
+    ctx.set_ignore_check(true);
+    std::istringstream is(bench);
+    VERIFY(parse_smt2_commands(ctx, is));
+    smt_params fp;
+    fp.updt_params(p);
+    smt::kernel k(m, fp, p);
+    for (expr* a : ctx.assertions())
+        k.assert_expr(a);
+    lbool r = k.check();
+    if (r == l_true) {
+        model_ref mdl;
+        k.get_model(mdl);
+        for (expr* a : ctx.assertions())
+            ENSURE(mdl->is_true(a));
+    }
+    k.collect_statistics(st);
+    return r;
+}
+
+static unsigned get_stat(statistics const& st, char const* key) {
+    unsigned r = 0;
+    for (unsigned i = 0; i < st.size(); ++i)
+        if (st.is_uint(i) && strcmp(st.get_key(i), key) == 0)
+            r += st.get_uint_value(i);
+    return r;
+}
+
+/**
+   \brief Solve the benchmarks with p, check the answers and add up the statistics in st.
+*/
+static void check_benches(params_ref const& p, option_bench const* benches, unsigned n, statistics& st) {
+    for (unsigned i = 0; i < n; ++i)
+        ENSURE(check_with(benches[i].m_bench, p, st) == benches[i].m_status);
+}
+
+static option_bench const bv_benches[] = {
+    { "(declare-const x (_ BitVec 16)) (declare-const y (_ BitVec 16))"
+      "(assert (= (bvmul x y) #x0f0f)) (assert (bvugt x #x0001)) (assert (bvugt y #x0001))", l_true },
+    { "(declare-const x (_ BitVec 16))"
+      "(assert (= (bvmul x #x0002) #x0001))", l_false },
+    { "(declare-const x (_ BitVec 16)) (declare-const y (_ BitVec 16))"
+      "(assert (= y #x000a)) (assert (= (bvudiv x y) #x0007)) (assert (= (bvurem x y) #x0003))", l_true },
+    { "(declare-const x (_ BitVec 4)) (declare-const y (_ BitVec 4))"
+      "(assert (not (= y #x0))) (assert (bvuge (bvurem x y) y))", l_false },
+    { "(declare-const x (_ BitVec 16))"
+      "(assert (not (= (bvudiv x #x0000) #xffff)))", l_false },
+    { "(declare-const x (_ BitVec 12)) (declare-const y (_ BitVec 12)) (declare-const z (_ BitVec 12))"
+      "(assert (= (bvmul x y) (bvmul y x))) (assert (= (bvmul (bvadd x z) y) #x7a1)) (assert (bvult z #x010))", l_true },
+    { "(declare-const x (_ BitVec 16)) (declare-const y (_ BitVec 16))"
+      "(assert (bvule x #x0010)) (assert (bvule y #x0010)) (assert (= (bvmul x y) #x00f0))", l_true },
+    { "(declare-const x (_ BitVec 16)) (declare-const y (_ BitVec 16))"
+      "(assert (bvule x #x0010)) (assert (bvule y #x0010)) (assert (= (bvmul x y) #x0121))", l_false },
+    { "(declare-const x (_ BitVec 16)) (declare-const y (_ BitVec 16))"
+      "(assert (bvule #x0100 x)) (assert (bvule y #x0010)) (assert (not (= y #x0000))) (assert (bvule (bvudiv x y) #x000f))", l_false },
+    { "(declare-const x (_ BitVec 16)) (declare-const y (_ BitVec 16))"
+      "(assert (bvule x #x0020)) (assert (bvule #x0009 (bvurem x y)))", l_true },
+};
+
+#define FP_SORT "(_ FloatingPoint 3 5)"
+#define FP(v) "((_ to_fp 3 5) RNE " v ")"
+
+static option_bench const fp_benches[] = {
+    { "(declare-const x " FP_SORT ") (declare-const y " FP_SORT ")"
+      "(assert (fp.eq (fp.mul RNE x y) " FP("6.0") ")) (assert (fp.gt x " FP("1.0") ")) (assert (fp.gt y " FP("1.0") "))", l_true },
+    { "(declare-const x " FP_SORT ")"
+      "(assert (fp.lt (fp.mul RNE x x) " FP("(- 1.0)") "))", l_false },
+    { "(declare-const x " FP_SORT ") (declare-const y " FP_SORT ")"
+      "(assert (fp.eq (fp.div RNE x y) " FP("2.0") ")) (assert (fp.eq y " FP("3.0") "))", l_true },
+    { "(declare-const x " FP_SORT ")"
+      "(assert (not (fp.isNaN x))) (assert (fp.isNegative (fp.fma RNE x x (_ +zero 3 5))))", l_false },
+    { "(declare-const x " FP_SORT ")"
+      "(assert (fp.eq (fp.sqrt RNE x) " FP("2.0") "))", l_true },
+    { "(declare-const x " FP_SORT ")"
+      "(assert (fp.lt (fp.sqrt RNE x) " FP("(- 1.0)") "))", l_false },
+    { "(declare-const x " FP_SORT ") (declare-const y " FP_SORT ")"
+      "(assert (fp.eq (fp.rem x y) " FP("1.0") ")) (assert (fp.eq y " FP("3.0") "))", l_true },
+    { "(declare-const x " FP_SORT ") (declare-const y " FP_SORT ")"
+      "(assert (fp.eq y " FP("3.0") ")) (assert (fp.gt (fp.rem x y) " FP("2.0") "))", l_false },
+};
+
+#undef FP
+#undef FP_SORT
+
+static option_bench const lra_benches[] = {
+    { "(declare-const x Real) (declare-const y Real) (declare-const z Real)"
+      "(assert (<= (+ x y) 10.0)) (assert (>= (- x y) 2.0)) (assert (>= (+ x (* 2.0 z)) 7.5)) (assert (<= z 1.0))", l_true },
+    { "(declare-const x Real) (declare-const y Real) (declare-const z Real)"
+      "(assert (<= (+ x y) 10.0)) (assert (>= (- x y) 2.0)) (assert (>= y 4.5)) (assert (<= (+ x z) 3.0)) (assert (>= z (- 1.0)))", l_false },
+    { "(declare-const x Real) (declare-const y Real) (declare-const z Real) (declare-const w Real)"
+      "(assert (or (<= (+ x y z) 1.0) (>= (- x w) 5.0))) (assert (>= x 2.0)) (assert (>= y 0.0)) (assert (>= z 0.0))"
+      "(assert (<= w (- x 4.0))) (assert (or (<= (+ w y) 0.0) (>= z 3.0)))", l_true },
+    { "(declare-const x Int) (declare-const y Int)"
+      "(assert (<= (+ (* 2 x) (* 2 y)) 7)) (assert (>= (+ (* 2 x) (* 2 y)) 7))", l_false },
+    { "(declare-const a Real) (declare-const b Real) (declare-const c Real) (declare-const d Real) (declare-const e Real)"
+      "(assert (<= (+ a b) c)) (assert (<= (+ c d) e)) (assert (<= e 4.0)) (assert (>= a 1.0)) (assert (>= b 1.0))"
+      "(assert (>= d 1.0)) (assert (distinct a b)) (assert (or (>= d 2.0) (>= c 3.5)))", l_false },
+    { "(declare-const x Real) (declare-const y Real) (declare-const z Real)"
+      "(assert (< (+ x y z) 3.0)) (assert (> x 1.0)) (assert (>= y 1.0)) (assert (or (>= z 1.0) (> (- y z) 5.0)))", l_true },
+    { "(declare-const x Real) (declare-const y Real) (declare-const z Real)"
+      "(assert (< (+ x y z) 3.0)) (assert (> x 1.0)) (assert (>= y 1.0)) (assert (>= z 1.0))", l_false },
+    { "(declare-const x Real) (declare-const y Real) (declare-const z Real) (declare-const u Real)"
+      "(assert (<= (- (+ x (* 3.0 y)) z) 4.0)) (assert (>= x 0.0)) (assert (>= y 0.0)) (assert (<= z 2.0))"
+      "(assert (or (>= y 2.5) (>= x 7.0) (< u x))) (assert (or (< u (- 3.0)) (> u 6.0)))", l_true },
+};
+
+// solved with arith.nl.nra=false, so the Groebner solver is not bypassed by nlsat
+static option_bench const nla_benches[] = {
+    { "(declare-const x Real) (declare-const y Real) (declare-const z Real)"
+      "(assert (= (* x y) 1.0)) (assert (= (* x z) 2.0)) (assert (= (+ y z) 0.0))", l_false },
+    { "(declare-const x Real) (declare-const y Real) (declare-const u Real)"
+      "(assert (= (* x y) u)) (assert (= (* x x) 4.0)) (assert (= (* y y) 9.0)) (assert (> u 7.0))", l_false },
+    { "(declare-const x Real) (declare-const y Real) (declare-const z Real)"
+      "(assert (= (* x y) 1.0)) (assert (= (* x z) 2.0)) (assert (= (+ y z) 3.0))", l_true },
+    { "(declare-const x Int) (declare-const y Int)"
+      "(assert (= (* x y) 6)) (assert (= (+ x y) 5)) (assert (< x y))", l_true },
+};
+
+static void tst_bv_lazy_blast() {
+    unsigned n = sizeof(bv_benches) / sizeof(bv_benches[0]);
+    params_ref eager, lazy;
+    eager.set_bool("bv.lazy_blast", false);
+    lazy.set_bool("bv.lazy_blast", true);
+    statistics st_eager, st_lazy;
+    check_benches(eager, bv_benches, n, st_eager);
+    check_benches(lazy, bv_benches, n, st_lazy);
+    ENSURE(get_stat(st_eager, "bv lazy ops") == 0);
+    ENSURE(get_stat(st_lazy, "bv lazy ops") > 0);
+    ENSURE(get_stat(st_lazy, "bv lazy blasted") > 0);
+    // the bounds on the factors refute the product without its circuit
+    statistics st;
+    ENSURE(check_with(bv_benches[7].m_bench, lazy, st) == l_false);
+    ENSURE(get_stat(st, "bv lazy ops") > 0);
+    ENSURE(get_stat(st, "bv lazy blasted") == 0);
+    // the remainder has no model, so it ends up bit-blasted
+    st.reset();
+    ENSURE(check_with(bv_benches[3].m_bench, lazy, st) == l_false);
+    ENSURE(get_stat(st, "bv lazy blasted") > 0);
+}
+
+static option_bench const bv_word_benches[] = {
+    { "(declare-const x (_ BitVec 16)) (declare-const y (_ BitVec 16))"
+      "(assert (bvule x #x0010)) (assert (bvule y #x0010)) (assert (bvugt (bvadd x y) #x0020))", l_false },
+    { "(declare-const x (_ BitVec 16)) (declare-const y (_ BitVec 16))"
+      "(assert (bvule x #x0010)) (assert (bvule y #x0010)) (assert (= (bvadd x y) #x0020))", l_true },
+    { "(declare-const x (_ BitVec 16))"
+      "(assert (bvule x #x00ff)) (assert (not (= ((_ extract 15 8) x) #x00)))", l_false },
+};
+
+static void tst_bv_word_propagation() {
+    unsigned n = sizeof(bv_word_benches) / sizeof(bv_word_benches[0]);
+    params_ref lazy;
+    lazy.set_bool("bv.lazy_blast", true);
+    statistics st;
+    check_benches(lazy, bv_word_benches, n, st);
+    ENSURE(get_stat(st, "bv word propagations") > 0);
+}
+
+static void tst_fp_lazy_blast() {
+    unsigned n = sizeof(fp_benches) / sizeof(fp_benches[0]);
+    params_ref eager, lazy;
+    eager.set_bool("fp.lazy_blast", false);
+    lazy.set_bool("fp.lazy_blast", true);
+    statistics st_eager, st_lazy;
+    check_benches(eager, fp_benches, n, st_eager);
+    check_benches(lazy, fp_benches, n, st_lazy);
+    ENSURE(get_stat(st_eager, "fpa lazy ops") == 0);
+    ENSURE(get_stat(st_lazy, "fpa lazy ops") >= n);
+    ENSURE(get_stat(st_lazy, "fpa lazy blasted") > 0);
+}
+
+static void tst_bound_propagation() {
+    unsigned n = sizeof(lra_benches) / sizeof(lra_benches[0]);
+    params_ref bprop_off, bprop_on, bprop_pivoted;
+    bprop_off.set_uint("arith.propagation_mode", 0);
+    bprop_on.set_uint("arith.propagation_mode", 2);
+    bprop_pivoted.set_uint("arith.propagation_mode", 2);
+    bprop_pivoted.set_bool("arith.bprop_on_pivoted_rows", false);
+    statistics st_off, st_on, st_pivoted;
+    check_benches(bprop_off, lra_benches, n, st_off);
+    check_benches(bprop_on, lra_benches, n, st_on);
+    check_benches(bprop_pivoted, lra_benches, n, st_pivoted);
+    ENSURE(get_stat(st_off, "arith-bound-propagations-lp") == 0);
+    ENSURE(get_stat(st_on, "arith-bound-propagations-lp") > 0);
+    ENSURE(get_stat(st_pivoted, "arith-bound-propagations-lp") > 0);
+}
+
+static void tst_grobner_threads() {
+    unsigned n = sizeof(nla_benches) / sizeof(nla_benches[0]);
+    params_ref gb_seq, gb_par;
+    gb_seq.set_bool("arith.nl.nra", false);
+    gb_seq.set_uint("arith.nl.grobner_frequency", 1);
+    gb_par.set_bool("arith.nl.nra", false);
+    gb_par.set_uint("arith.nl.grobner_frequency", 1);
+    gb_par.set_uint("arith.nl.grobner_threads", 3);
+    statistics st_seq, st_par;
+    check_benches(gb_seq, nla_benches, n, st_seq);
+    check_benches(gb_par, nla_benches, n, st_par);
+    ENSURE(get_stat(st_seq, "arith-grobner-calls") > 0);
+    ENSURE(get_stat(st_seq, "arith-grobner-shards") == 0);
+    ENSURE(get_stat(st_par, "arith-grobner-calls") > 0);
+    ENSURE(get_stat(st_par, "arith-grobner-shards") > 0);
+    ENSURE(get_stat(st_par, "dd.solver.shards") > 0);
+}
+
+static void assert_new(cmd_context& ctx, smt::kernel& k, unsigned& qhead) {
+    for (; qhead < ctx.assertions().size(); ++qhead)
+        k.assert_expr(ctx.assertions()[qhead]);
+}
+
+static void parse(cmd_context& ctx, char const* bench) {
+    std::istringstream is(bench);
+    VERIFY(parse_smt2_commands(ctx, is));
+}
+
+static void tst_mbqi_cache() {
+    ast_manager m;
+    reg_decl_plugins(m);
+    cmd_context ctx(false, &m);
+    ctx.set_ignore_check(true);
+    smt_params fp;
+    smt::kernel k(m, fp);
+    unsigned qhead = 0;
+    parse(ctx,
+          "(declare-fun f (Int) Int) (declare-fun g (Int) Int) (declare-const a Int) (declare-const b Int)"
+          "(assert (forall ((x Int)) (>= (f x) 0)))"
+          "(assert (forall ((x Int)) (<= (g x) (f x))))"
+          "(assert (> (g a) 2))");
+    assert_new(ctx, k, qhead);
+    ENSURE(k.check() == l_true);
+    // the quantifiers of the base level are checked again in the scope
+    char const* scoped = "(assert (forall ((x Int)) (> (f x) 5)))";
+    k.push();
+    parse(ctx, scoped);
+    assert_new(ctx, k, qhead);
+    ENSURE(k.check() == l_true);
+    k.pop(1);
+    // the cached check of the popped quantifier is dropped, and a later copy is checked again
+    parse(ctx, "(assert (= (f b) 1))");
+    qhead = ctx.assertions().size() - 1;
+    assert_new(ctx, k, qhead);
+    ENSURE(k.check() == l_true);
+    k.push();
+    parse(ctx, scoped);
+    assert_new(ctx, k, qhead);
+    ENSURE(k.check() == l_false);
+    k.pop(1);
+    statistics st;
+    k.collect_statistics(st);
+    ENSURE(get_stat(st, "mbqi checks") > 0);
+    ENSURE(get_stat(st, "mbqi cached checks") > 0);
+}
+
+/**
+   \brief pigeon hole problem with n + 1 pigeons and n holes.
+*/
+static std::string mk_php(unsigned n) {
+    std::ostringstream out;
+    auto p = [&](unsigned i, unsigned j) { return "p" + std::to_string(i) + "_" + std::to_string(j); };
+    for (unsigned i = 0; i <= n; ++i)
+        for (unsigned j = 0; j < n; ++j)
+            out << "(declare-const " << p(i, j) << " Bool)";
+    for (unsigned i = 0; i <= n; ++i) {
+        out << "(assert (or";
+        for (unsigned j = 0; j < n; ++j)
+            out << " " << p(i, j);
+        out << "))";
+    }
+    for (unsigned j = 0; j < n; ++j)
+        for (unsigned i = 0; i <= n; ++i)
+            for (unsigned k = i + 1; k <= n; ++k)
+                out << "(assert (or (not " << p(i, j) << ") (not " << p(k, j) << ")))";
+    return out.str();
+}
+
+static void tst_minimize_cache() {
+    params_ref p;
+    statistics st;
+    ENSURE(check_with(mk_php(4).c_str(), p, st) == l_false);
+    ENSURE(get_stat(st, "minimize steps") > 0);
+    ENSURE(get_stat(st, "minimize cache hits") > 0);
+}
+
+// six distinct values of f over arguments that all equal one of five constants
+static char const* dack_bench =
+    "(declare-sort U 0) (declare-fun f (U) U)"
+    "(declare-const a0 U) (declare-const a1 U) (declare-const a2 U) (declare-const a3 U) (declare-const a4 U) (declare-const a5 U)"
+    "(declare-const b0 U) (declare-const b1 U) (declare-const b2 U) (declare-const b3 U) (declare-const b4 U)"
+    "(assert (or (= a0 b0) (= a0 b1) (= a0 b2) (= a0 b3) (= a0 b4)))"
+    "(assert (or (= a1 b0) (= a1 b1) (= a1 b2) (= a1 b3) (= a1 b4)))"
+    "(assert (or (= a2 b0) (= a2 b1) (= a2 b2) (= a2 b3) (= a2 b4)))"
+    "(assert (or (= a3 b0) (= a3 b1) (= a3 b2) (= a3 b3) (= a3 b4)))"
+    "(assert (or (= a4 b0) (= a4 b1) (= a4 b2) (= a4 b3) (= a4 b4)))"
+    "(assert (or (= a5 b0) (= a5 b1) (= a5 b2) (= a5 b3) (= a5 b4)))"
+    "(assert (distinct (f a0) (f a1) (f a2) (f a3) (f a4) (f a5)))";
+
+static void tst_dack_sketch() {
+    params_ref off, exact, sketch, batched;
+    off.set_uint("dack", 0);
+    sketch.set_uint("dack.sketch_bits", 12);
+    batched.set_uint("dack.sketch_bits", 12);
+    batched.set_bool("dack.adaptive", true);
+    batched.set_bool("dack.restart", true);
+    statistics st_off, st_exact, st_sketch, st_batched;
+    ENSURE(check_with(dack_bench, off, st_off) == l_false);
+    ENSURE(check_with(dack_bench, exact, st_exact) == l_false);
+    ENSURE(check_with(dack_bench, sketch, st_sketch) == l_false);
+    ENSURE(check_with(dack_bench, batched, st_batched) == l_false);
+    ENSURE(get_stat(st_off, "dyn ack") == 0);
+    ENSURE(get_stat(st_exact, "dyn ack") > 0);
+    // congruences still reach the threshold through the sketch
+    ENSURE(get_stat(st_sketch, "dyn ack") > 0);
+    ENSURE(get_stat(st_batched, "dyn ack") > 0);
+}
+
+static void tst_array_upward_axioms() {
+    char const* bench =
+        "(declare-const a (Array Int Int)) (declare-const b (Array Int Int)) (declare-const c (Array Int Int))"
+        "(declare-const i Int) (declare-const j Int) (declare-const k Int)"
+        "(assert (= b (store a i 1))) (assert (= c (store b j 2)))"
+        "(assert (= (select a k) 5)) (assert (= (select a j) 6))"
+        "(assert (or (= k i) (= k j) (> k 10)))"
+        "(assert (not (= (select c k) 5)))";
+    params_ref p;
+    statistics st;
+    ENSURE(check_with(bench, p, st) == l_true);
+    ENSURE(get_stat(st, "array exp ax2") > 0);
+    std::string unsat = std::string(bench) + "(assert (not (= k i))) (assert (not (= k j)))";
+    st.reset();
+    ENSURE(check_with(unsat.c_str(), p, st) == l_false);
+}
+
+static void tst_datatype_occurs_check() {
+    char const* bench =
+        "(declare-datatypes ((L 0)) (((nil) (cons (hd Int) (tl L)))))"
+        "(declare-const x L) (declare-const y L) (declare-const z L) (declare-const u L) (declare-const w L)"
+        "(assert (= x (cons 1 (cons 2 (cons 3 y))))) (assert (= y (cons 4 z)))"
+        "(assert ((_ is cons) u)) (assert ((_ is cons) (tl u))) (assert ((_ is cons) w))"
+        "(assert (> (hd u) (hd w))) (assert (not (= (tl (tl u)) x))) (assert (not (= z w)))";
+    params_ref p;
+    statistics st;
+    ENSURE(check_with(bench, p, st) == l_true);
+    ENSURE(get_stat(st, "datatype occurs check cached") > 0);
+    // the cycle through z is found after z was cached as cycle free in an earlier final check
+    std::string cyclic = std::string(bench) + "(assert (or (= z x) (= z u))) (assert (= u (cons 7 (cons 8 y))))";
+    st.reset();
+    ENSURE(check_with(cyclic.c_str(), p, st) == l_false);
+}
+
+static void tst_recfun_cache() {
+    char const* bench =
+        "(declare-datatypes ((L 0)) (((nil) (cons (hd Int) (tl L)))))"
+        "(define-fun-rec len ((l L)) Int (ite (= l nil) 0 (+ 1 (len (tl l)))))"
+        "(declare-const x L) (declare-const y L)"
+        "(assert (= (len x) 4)) (assert (= (len y) (+ (len x) 2)))"
+        "(assert (or (> (hd x) 3) (< (hd y) 0)))";
+    params_ref p;
+    statistics st;
+    ENSURE(check_with(bench, p, st) == l_true);
+    ENSURE(get_stat(st, "recfun cached expansion") > 0);
+    std::string unsat = std::string(bench) + "(assert (= x y))";
+    st.reset();
+    ENSURE(check_with(unsat.c_str(), p, st) == l_false);
+}
+
+void tst_smt_options() {
+    tst_bv_lazy_blast();
+    tst_bv_word_propagation();
+    tst_fp_lazy_blast();
+    tst_bound_propagation();
+    tst_grobner_threads();
+    tst_mbqi_cache();
+    tst_minimize_cache();
+    tst_dack_sketch();
+    tst_array_upward_axioms();
+    tst_datatype_occurs_check();
+    tst_recfun_cache();
+}
@@ -0,0 +1,84 @@
+/*++
+Copyright (c) 2023 Microsoft Corporation
+
+Module Name:
+
+    special_relations.cpp
+
+Abstract:
+
+    Test the reachability index of partial orders in theory_special_relations.
+
+Revision History:
+
+--*/
+#include <cstring>
+#include <sstream>
+#include "ast/reg_decl_plugins.h"
+#include "model/model.h"
+#include "cmd_context/cmd_context.h"
+#include "parsers/smt2/smt2parser.h"
+#include "smt/smt_kernel.h"
+#include "smt/params/smt_params.h"
+
+static unsigned get_stat(statistics const& st, char const* key) {
+    for (unsigned i = 0; i < st.size(); ++i)
+        if (st.is_uint(i) && strcmp(st.get_key(i), key) == 0)
+            return st.get_uint_value(i);
+    return 0;
+}
+
+static lbool check_po(char const* bench, statistics& st) {
+    ast_manager m;
+    reg_decl_plugins(m);
+    cmd_context ctx(false, &m);
+    ctx.set_ignore_check(true);
+    std::istringstream is(bench);
+    VERIFY(parse_smt2_commands(ctx, is));
+    smt_params fp;
+    smt::kernel k(m, fp);
+    for (expr* a : ctx.assertions())
+        k.assert_expr(a);
+    lbool r = k.check();
+    if (r == l_true) {
+        model_ref mdl;
+        k.get_model(mdl);
+        for (expr* a : ctx.assertions())
+            ENSURE(mdl->is_true(a));
+    }
+    k.collect_statistics(st);
+    return r;
+}
+
+// a chain a <= b <= c <= d forces p through the atom a <= d.
+static char const* po_chain =
+    "(declare-sort S 0)"
+    "(declare-const a S) (declare-const b S) (declare-const c S) (declare-const d S) (declare-const p Bool)"
+    "(define-fun le ((x S) (y S)) Bool ((_ partial-order 0) x y))"
+    "(assert (le a b)) (assert (le b c)) (assert (le c d))"
+    "(assert (or (not (le a d)) p))";
+
+// the same chain in a second relation that is registered after a first relation
+// over unrelated terms, so the variables of the chain are not the first theory variables.
+static char const* po_shared =
+    "(declare-sort S 0)"
+    "(declare-const e S) (declare-const f S) (declare-const g S)"
+    "(declare-const a S) (declare-const b S) (declare-const c S) (declare-const d S)"
+    "(define-fun le0 ((x S) (y S)) Bool ((_ partial-order 0) x y))"
+    "(define-fun le1 ((x S) (y S)) Bool ((_ partial-order 1) x y))"
+    "(assert (le0 e f)) (assert (le0 f g))"
+    "(assert (le1 a b)) (assert (le1 b c)) (assert (le1 c d))"
+    "(assert (not (le1 a d)))";
+
+void tst_special_relations() {
+    statistics st;
+    ENSURE(check_po(po_chain, st) == l_true);
+    ENSURE(get_stat(st, "special relations reach propagations") > 0);
+    std::string neg = std::string(po_chain) + "(assert (not p))";
+    statistics st_neg;
+    ENSURE(check_po(neg.c_str(), st_neg) == l_false);
+    ENSURE(get_stat(st_neg, "special relations reach propagations") + get_stat(st_neg, "special relations reach conflicts") > 0);
+    statistics st_shared;
+    ENSURE(check_po(po_shared, st_shared) == l_false);
+    ENSURE(get_stat(st_shared, "special relations reach propagations") + get_stat(st_shared, "special relations reach conflicts") > 0);
+}
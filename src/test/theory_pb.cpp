@@ -11,6 +11,7 @@ Copyright (c) 2015 Microsoft Corporation
 #include "smt/theory_pb.h"
 #include "ast/rewriter/th_rewriter.h"
 #include <iostream>
+#include <cstring>
 
 static unsigned populate_literals(unsigned k, smt::literal_vector& lits) {
     ENSURE(k < (1u << lits.size()));
@@ -165,3 +166,66 @@ void tst_theory_pb() {
         }
     }
 }
+
+static unsigned get_stat(statistics const& st, char const* key) {
+    for (unsigned i = 0; i < st.size(); ++i)
+        if (st.is_uint(i) && strcmp(st.get_key(i), key) == 0)
+            return st.get_uint_value(i);
+    return 0;
+}
+
+/**
+   \brief 3C a + (2C+1) b + (C+1) c + C d >= 3C + 1 holds if a and one of b, c, d are true,
+   or if b and one of c, d are true. (or (not a) (not b)) leaves it satisfiable, and also
+   excluding a and b together with c or d makes it unsatisfiable.
+   The negation has bound 4C + 2, so the coefficients and bound of both sides add up to at most 11C + 4.
+   Return the number of inequalities that were tracked in machine integers.
+*/
+static unsigned check_large_coeffs(rational const& C, bool is_sat) {
+    ast_manager m;
+    reg_decl_plugins(m);
+    pb_util pb(m);
+    smt_params params;
+    params.m_model = true;
+    smt::context ctx(m, params);
+    expr_ref_vector args(m);
+    for (unsigned i = 0; i < 4; ++i)
+        args.push_back(m.mk_const(symbol(i), m.mk_bool_sort()));
+    rational coeffs[4] = { rational(3) * C, rational(2) * C + rational(1), C + rational(1), C };
+    rational k = rational(3) * C + rational(1);
+    expr_ref_vector fmls(m);
+    fmls.push_back(pb.mk_ge(args.size(), coeffs, args.data(), k));
+    auto mk_nand = [&](unsigned i, unsigned j) { return m.mk_or(m.mk_not(args.get(i)), m.mk_not(args.get(j))); };
+    fmls.push_back(mk_nand(0, 1));
+    if (!is_sat) {
+        fmls.push_back(mk_nand(0, 2));
+        fmls.push_back(mk_nand(0, 3));
+        fmls.push_back(mk_nand(1, 2));
+        fmls.push_back(mk_nand(1, 3));
+    }
+    for (expr* f : fmls)
+        ctx.assert_expr(f);
+    ENSURE(ctx.check() == (is_sat ? l_true : l_false));
+    if (is_sat) {
+        model_ref mdl;
+        ctx.get_model(mdl);
+        for (expr* f : fmls)
+            ENSURE(mdl->is_true(f));
+    }
+    statistics st;
+    ctx.collect_statistics(st);
+    ENSURE(get_stat(st, "pb predicates") > 0);
+    return get_stat(st, "pb int64 ineqs");
+}
+
+void tst_theory_pb_large_coeffs() {
+    // 11C + 4 stays below 2^60 for C_small and exceeds it for C_large
+    rational C_small = div(rational::power_of_two(60) - rational(5), rational(11));
+    rational C_large = C_small + rational(1);
+    for (bool is_sat : { true, false }) {
+        ENSURE(check_large_coeffs(rational(1000), is_sat) > 0);
+        ENSURE(check_large_coeffs(C_small, is_sat) > 0);
+        ENSURE(check_large_coeffs(C_large, is_sat) == 0);
+        ENSURE(check_large_coeffs(rational::power_of_two(62), is_sat) == 0);
+    }
+}
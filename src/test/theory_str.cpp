@@ -0,0 +1,85 @@
+/*++
+Copyright (c) 2023 Microsoft Corporation
+
+Module Name:
+
+    theory_str.cpp
+
+Abstract:
+
+    Test that theory_str keeps regex automata across searches.
+
+Revision History:
+
+--*/
+#include <cstring>
+#include <sstream>
+#include "ast/reg_decl_plugins.h"
+#include "model/model.h"
+#include "cmd_context/cmd_context.h"
+#include "parsers/smt2/smt2parser.h"
+#include "smt/smt_kernel.h"
+#include "smt/params/smt_params.h"
+
+static unsigned get_stat(statistics const& st, char const* key) {
+    for (unsigned i = 0; i < st.size(); ++i)
+        if (st.is_uint(i) && strcmp(st.get_key(i), key) == 0)
+            return st.get_uint_value(i);
+    return 0;
+}
+
+static void parse(cmd_context& ctx, char const* bench) {
+    std::istringstream is(bench);
+    VERIFY(parse_smt2_commands(ctx, is));
+}
+
+static void check_model(smt::kernel& k, expr_ref_vector const& fmls) {
+    model_ref mdl;
+    k.get_model(mdl);
+    for (expr* f : fmls)
+        ENSURE(mdl->is_true(f));
+}
+
+void tst_theory_str() {
+    ast_manager m;
+    reg_decl_plugins(m);
+    cmd_context ctx(false, &m);
+    ctx.set_ignore_check(true);
+    parse(ctx,
+          "(declare-const x String) (declare-const y String)"
+          "(assert (str.in_re x (re.+ (str.to_re \"ab\"))))"
+          "(assert (= (str.len x) 4))");
+    params_ref p;
+    p.set_sym("string_solver", symbol("z3str3"));
+    smt_params fp;
+    fp.updt_params(p);
+    smt::kernel k(m, fp, p);
+    expr_ref_vector fmls(m);
+    for (expr* a : ctx.assertions()) {
+        k.assert_expr(a);
+        fmls.push_back(a);
+    }
+    ENSURE(k.check() == l_true);
+    check_model(k, fmls);
+
+    // a second search over the same regex reuses its automaton
+    k.push();
+    parse(ctx, "(assert (str.in_re y (re.+ (str.to_re \"ab\")))) (assert (= (str.len y) 6))");
+    for (unsigned i = fmls.size(); i < ctx.assertions().size(); ++i) {
+        k.assert_expr(ctx.assertions()[i]);
+        fmls.push_back(ctx.assertions()[i]);
+    }
+    ENSURE(k.check() == l_true);
+    check_model(k, fmls);
+    k.pop(1);
+    fmls.shrink(2);
+
+    parse(ctx, "(assert (= (str.len x) 5))");
+    k.assert_expr(ctx.assertions().back());
+    ENSURE(k.check() == l_false);
+
+    statistics st;
+    k.collect_statistics(st);
+    ENSURE(get_stat(st, "str regex automata") > 0);
+    ENSURE(get_stat(st, "str regex automaton cache hits") > 0);
+}
@@ -1058,6 +1058,34 @@ static void tst_lower_bound() {
     tst_lower_bound((((x^5) - 1000000000)^3)*((3*x - 10000000)^2)*((10*x - 632)^2));
 }
 
+static void tst_karatsuba(upolynomial::manager & um, unsigned sz1, unsigned sz2, unsigned seed) {
+    upolynomial::scoped_numeral_vector p(um), q(um), r1(um), r2(um);
+    for (unsigned i = 0; i < sz1; i++) 
+        p.push_back(mpz(static_cast<int>(((i + 1) * 7919 * seed) % 2001) - 1000));
+    for (unsigned i = 0; i < sz2; i++) 
+        q.push_back(mpz(static_cast<int>(((i + 3) * 104729 * seed) % 1999) - 999));
+    um.set_karatsuba(false);
+    um.mul(p, q, r1);
+    um.set_karatsuba(true);
+    um.mul(p, q, r2);
+    ENSURE(um.eq(r1, r2));
+}
+
+static void tst_karatsuba() {
+    reslimit rl;
+    polynomial::numeral_manager nm;
+    upolynomial::manager um(rl, nm);
+    unsigned sizes[] = { 1, 5, 31, 32, 33, 47, 64, 100, 257 };
+    unsigned seed = 1;
+    for (unsigned sz1 : sizes) 
+        for (unsigned sz2 : sizes) 
+            tst_karatsuba(um, sz1, sz2, seed++);
+    // Z_p
+    um.set_zp(1000003);
+    tst_karatsuba(um, 100, 70, 11);
+    tst_karatsuba(um, 300, 33, 13);
+}
+
 void tst_upolynomial() {
     set_verbosity_level(1000);
     enable_trace("mpz_gcd");
@@ -1066,6 +1094,7 @@ void tst_upolynomial() {
     enable_trace("factor");
     // enable_trace("mpzp_inv_bug");
     // enable_trace("mpz");
+    tst_karatsuba();
     tst_gcd();
     tst_lower_bound();
     tst_fact();
@@ -0,0 +1,237 @@
+/*++
+Copyright (c) 2023 Microsoft Corporation
+
+Module Name:
+
+    dary_heap.h
+
+Abstract:
+
+    A d-ary heap of integers.
+
+    It has the same interface as heap<LT>, but each node has D children.
+    The tree is shallower, so insertions and priority increases touch
+    fewer nodes, and the children of a node are contiguous in memory.
+    This pays off once the heap no longer fits in cache; on small heaps
+    the binary heap is as fast.
+
+Revision History:
+
+--*/
+#pragma once
+
+#include "util/vector.h"
+#include "util/debug.h"
+#include <cstring>
+
+template<typename LT, unsigned D = 4>
+class dary_heap : private LT {
+    static_assert(D >= 2, "arity of a d-ary heap must be at least 2");
+
+    int_vector    m_values;
+    int_vector    m_value2indices; // value -> index + 1, 0 if the value is not in the heap
+
+    static int first_child(int i) {
+        return D * i + 1;
+    }
+
+    static int parent(int i) {
+        return (i - 1) / D;
+    }
+
+    int index_of(int val) const {
+        return m_value2indices[val] - 1;
+    }
+
+    void set_index(int val, int idx) {
+        m_value2indices[val] = idx + 1;
+    }
+
+    bool check_invariant_core() const {
+        for (int i = 0; i < static_cast<int>(m_values.size()); ++i) {
+            SASSERT(index_of(m_values[i]) == i);
+            SASSERT(i == 0 || !less_than(m_values[i], m_values[parent(i)]));
+        }
+        return true;
+    }
+
+public:
+    bool check_invariant() const {
+        return check_invariant_core();
+    }
+
+private:
+
+    void move_up(int idx) {
+        int val = m_values[idx];
+        while (idx > 0) {
+            int parent_idx = parent(idx);
+            if (!less_than(val, m_values[parent_idx]))
+                break;
+            m_values[idx] = m_values[parent_idx];
+            set_index(m_values[idx], idx);
+            idx           = parent_idx;
+        }
+        m_values[idx] = val;
+        set_index(val, idx);
+        CASSERT("heap", check_invariant());
+    }
+
+    void move_down(int idx) {
+        int val = m_values[idx];
+        int sz  = static_cast<int>(m_values.size());
+        while (true) {
+            int child_idx = first_child(idx);
+            if (child_idx >= sz)
+                break;
+            int end_idx = child_idx + static_cast<int>(D);
+            if (end_idx > sz)
+                end_idx = sz;
+            // keep the smallest sibling in a register instead of reloading it for every comparison.
+            int min_idx   = child_idx;
+            int min_value = m_values[child_idx];
+            for (++child_idx; child_idx < end_idx; ++child_idx) {
+                int v = m_values[child_idx];
+                if (less_than(v, min_value)) {
+                    min_idx   = child_idx;
+                    min_value = v;
+                }
+            }
+            if (!less_than(min_value, val))
+                break;
+            m_values[idx] = min_value;
+            set_index(min_value, idx);
+            idx           = min_idx;
+        }
+        m_values[idx] = val;
+        set_index(val, idx);
+        CASSERT("heap", check_invariant());
+    }
+
+public:
+    typedef int * iterator;
+    typedef const int * const_iterator;
+
+    dary_heap(int s, const LT & lt = LT()):LT(lt) {
+        set_bounds(s);
+    }
+
+    bool less_than(int v1, int v2) const {
+        return LT::operator()(v1, v2);
+    }
+
+    bool empty() const {
+        return m_values.empty();
+    }
+
+    bool contains(int val) const {
+        return val < static_cast<int>(m_value2indices.size()) && m_value2indices[val] != 0;
+    }
+
+    void reset() {
+        if (empty())
+            return;
+        memset(m_value2indices.data(), 0, sizeof(int) * m_value2indices.size());
+        m_values.reset();
+    }
+
+    void clear() {
+        reset();
+    }
+
+    void set_bounds(int s) {
+        m_value2indices.resize(s, 0);
+    }
+
+    unsigned get_bounds() const {
+        return m_value2indices.size();
+    }
+
+    unsigned size() const {
+        return m_value2indices.size();
+    }
+
+    void reserve(int s) {
+        if (s > static_cast<int>(m_value2indices.size()))
+            set_bounds(s);
+    }
+
+    int min_value() const {
+        SASSERT(!empty());
+        return m_values[0];
+    }
+
+    int erase_min() {
+        SASSERT(!empty());
+        int result = m_values[0];
+        int last_val = m_values.back();
+        m_values.pop_back();
+        m_value2indices[result] = 0;
+        if (!m_values.empty()) {
+            m_values[0] = last_val;
+            set_index(last_val, 0);
+            move_down(0);
+        }
+        CASSERT("heap", check_invariant());
+        return result;
+    }
+
+    void erase(int val) {
+        SASSERT(contains(val));
+        int idx      = index_of(val);
+        int last_val = m_values.back();
+        m_values.pop_back();
+        m_value2indices[val] = 0;
+        if (idx < static_cast<int>(m_values.size())) {
+            m_values[idx] = last_val;
+            set_index(last_val, idx);
+            if (idx > 0 && less_than(last_val, m_values[parent(idx)]))
+                move_up(idx);
+            else
+                move_down(idx);
+        }
+        CASSERT("heap", check_invariant());
+    }
+
+    void decreased(int val) {
+        SASSERT(contains(val));
+        move_up(index_of(val));
+    }
+
+    void increased(int val) {
+        SASSERT(contains(val));
+        move_down(index_of(val));
+    }
+
+    void insert(int val) {
+        SASSERT(!contains(val));
+        SASSERT(0 <= val && val < static_cast<int>(m_value2indices.size()));
+        int idx = static_cast<int>(m_values.size());
+        m_values.push_back(val);
+        set_index(val, idx);
+        move_up(idx);
+    }
+
+    iterator begin() {
+        return m_values.data();
+    }
+
+    iterator end() {
+        return m_values.data() + m_values.size();
+    }
+
+    const_iterator begin() const {
+        return m_values.begin();
+    }
+
+    const_iterator end() const {
+        return m_values.end();
+    }
+
+    void swap(dary_heap & other) {
+        if (this != &other) {
+            m_values.swap(other.m_values);
+            m_value2indices.swap(other.m_value2indices);
+        }
+    }
+};
@@ -0,0 +1,25 @@
+#!/bin/bash
+# Run z3 on the benchmarks of a directory once per value of a parameter and report the time of each run.
+# usage: ./compare_param.sh param "values" [dir] [ext] [timeout-seconds] [extra z3 options]
+# e.g.   ./compare_param.sh smt.case_split "0 1 2 3 4 5 6 7" QF_NIA smt2 60 auto_config=false
+#        PATTERN="status is|lp-stats" ./compare_param.sh smt.arith.refactor_interval "1 200" MPS mps 60 smt.arith.print_stats=true
+# PATTERN selects the lines of the output that are reported.
+param=$1
+values=$2
+dir=${3:-QF_NIA}
+ext=${4:-smt2}
+timeout=${5:-60}
+extra=${@:6}
+pattern=${PATTERN:-"^(sat|unsat|unknown|timeout)"}
+
+for file in $dir/*.$ext
+do
+    for value in $values
+    do
+        start=$[$(date +%s%N)/1000000]
+        res=$(../build/z3 $file $param=$value $extra -T:$timeout -memory:30720 | grep -E "$pattern" | tr '\n' ' ')
+        end=$[$(date +%s%N)/1000000]
+        take=$(( end - start ))
+        echo $file : $param=$value : $res : ${take} ms.
+    done
+done